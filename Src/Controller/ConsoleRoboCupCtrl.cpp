@@ -69,7 +69,17 @@ bool ConsoleRoboCupCtrl::compile()
   std::string::size_type p2 = fileName.find_last_of(".");
   if(p2 > p)
     fileName = fileName.substr(0, p2);
+
+  // Options of a headless SimRobot
+  headless = !application->getOption("headless").isEmpty();
+  teamPortOffset = 10 * application->getOption("instance").toInt();
+  const std::string script = application->getOption("script").toUtf8().constData();
+  summaryFile = application->getOption("summary").toUtf8().constData();
+  logsDir = application->getOption("logs").toUtf8().constData();
+
   executeFile("", fileName, false, nullptr, true);
+  if(!script.empty())
+    executeFile("", script, false, nullptr, true);
 
   if(!RoboCupCtrl::compile())
     return false;
@@ -77,9 +87,19 @@ bool ConsoleRoboCupCtrl::compile()
   if(!robots.empty())
     selected.push_back((*robots.begin())->getRobotThread());
 
+  // Without a GUI, the simulation runs as fast as possible in simulated time.
+  if(headless)
+  {
+    delayTime = 0.f;
+    time = getTime();
+    simTime = true;
+  }
+
   start();
 
   executeFile("", fileName, false, nullptr, false);
+  if(!script.empty())
+    executeFile("", script, true, nullptr, false);
 
   for(Robot* robot : robots)
     robot->getRobotThread()->handleConsole("endOfStartScript");
@@ -109,6 +129,16 @@ void ConsoleRoboCupCtrl::link()
 
 ConsoleRoboCupCtrl::~ConsoleRoboCupCtrl()
 {
+  if(!summaryFile.empty() && !gameController.writeSummary(summaryFile))
+    std::cerr << "Could not write " << summaryFile << std::endl;
+
+  if(!logsDir.empty())
+  {
+    QDir().mkpath(logsDir.c_str());
+    for(Robot* robot : robots)
+      robot->getRobotThread()->handleConsole("log save " + logsDir + "/" + robot->getName() + ".log");
+  }
+
   for(RemoteRobot* remoteRobot : remoteRobots)
     remoteRobot->announceStop();
 
@@ -129,13 +159,20 @@ void ConsoleRoboCupCtrl::update()
     SYNC;
     for(const std::string& textMessage : textMessages)
     {
-      if(textMessage == "_cls")
+      if(headless)
+      {
+        if(textMessage != "_cls")
+          std::cout << textMessage << (newLine || &textMessage != &*textMessages.rend() ? "\n" : "");
+      }
+      else if(textMessage == "_cls")
         consoleView->clear();
       else if(newLine || &textMessage != &*textMessages.rend())
         consoleView->printLn(textMessage.c_str());
       else
         consoleView->print(textMessage.c_str());
     }
+    if(headless && !textMessages.empty())
+      std::cout.flush();
     textMessages.clear();
   }
   RoboCupCtrl::update();
@@ -249,7 +286,7 @@ void ConsoleRoboCupCtrl::setRepresentation(const std::string& representationName
 
 void ConsoleRoboCupCtrl::executeConsoleCommand(std::string command, RobotConsole* console, bool scenarioAndLocationOnly)
 {
-  if(!scenarioAndLocationOnly)
+  if(!scenarioAndLocationOnly && !headless)
     showInputDialog(command);
   std::string buffer;
   InConfigMemory stream(command.c_str(), command.size());
@@ -513,6 +550,7 @@ void ConsoleRoboCupCtrl::help(In& stream)
   list("  # <text> : Comment.", pattern, true);
   list("Robot commands:", pattern, true);
   list("  bc [<red%> [<green%> [<blue%>]]] : Set the background color of all 3-D views.", pattern, true);
+  list("  bm start | stop | save [<file>] | compare <file> [<tolerance%>] : Record the times of all stopwatches (requires dr timing) and save them or compare them with a saved baseline. Regressions let a headless run fail.", pattern, true);
   list("  dr ? [<pattern>] | off | <key> ( off | on ) : Send debug request.", pattern, true);
   list("  get ? [<pattern>] | <key> [?]: Show debug data or show its specification.", pattern, true);
   list("  jc hide | show | motion ( 1 | 2 ) <command> | ( press | release ) <button> <command> : Set joystick motion (use $1 .. $8) or button command.", pattern, true);
@@ -520,6 +558,7 @@ void ConsoleRoboCupCtrl::help(In& stream)
   list("  js <axis> <speed> <threshold> [<center>] : Set axis maximum speed and ignore threshold for \"jc motion\" commands.", pattern, true);
   list("  kick : Adds the KickEngine view.", pattern, true);
   list("  log start | stop | clear | full | jpeg : Record log file and (de)activate image compression.", pattern, true);
+  list("  log batch <directory> <command> : Execute a log save... command for all log files in the directory and its subdirectories.", pattern, true);
   list("  log save [split <parts>] [<file>] : Save log file with given name or modified current log file name. Split command saves in given number of parts", pattern, true);
   list("  log saveAudio [<file>] : Save audio data from log.", pattern, true);
   list("  log saveImages [raw] [onlyPlaying] [<takeEachNth>] [<dir>] : Save images from log.", pattern, true);
@@ -533,6 +572,7 @@ void ConsoleRoboCupCtrl::help(In& stream)
   list("  log keep ( ballPercept [ seen | guessed ] | ballSpots | circlePercept | lower | option <option> [<state>] | penaltyMarkPercept | upper ): Remove the log's frames not matching specified criteria.", pattern, true);
   list("  log ( keep | remove ) <message> {<message>} : Filter specified messages of all frames.", pattern, true);
   list("  log start | pause | stop | forward [image] | backward [image] | repeat | goto <number> | time <minutes> <seconds> | cycle | once | fastForward | fastBackward : Replay log file.", pattern, true);
+  list("  log steps | fast : Replay one frame per simulation step or as fast as the robot code processes them in the original order.", pattern, true);
   list("  log mr [list] : Generate module requests to replay log file.", pattern, true);
   list("  mof : Recompile motion net and send it to the robot. ", pattern, true);
   list("  msg off | on | log <file> | enable | disable : Switch output of text messages on or off. Log text messages to a file. Switch message handling on or off.", pattern, true);
@@ -723,6 +763,10 @@ void ConsoleRoboCupCtrl::createCompletion()
     "ar off",
     "ar on",
     "bc",
+    "bm compare",
+    "bm save",
+    "bm start",
+    "bm stop",
     "kick",
     "call",
     "ci off",
@@ -742,6 +786,7 @@ void ConsoleRoboCupCtrl::createCompletion()
     "log start",
     "log stop",
     "log clear",
+    "log batch",
     "log save split",
     "log full",
     "log jpeg",
@@ -759,6 +804,8 @@ void ConsoleRoboCupCtrl::createCompletion()
     "log load",
     "log cycle",
     "log once",
+    "log steps",
+    "log fast",
     "log pause",
     "log forward image",
     "log backward image",
@@ -52,6 +52,9 @@ private:
   const RobotConsole::Views* fieldViews = nullptr; /**< Points to the map of field views used for tab-completion. */
   const RobotConsole::PlotViews* plotViews = nullptr; /**< Points to the map of plot views used for tab-completion. */
   BHToolBar toolBar; /**< The toolbar shown for this controller. */
+  bool headless = false; /**< Does SimRobot run without a GUI? Then the console output is written to stdout. */
+  std::string summaryFile; /**< The file a summary of the game is written to at the end, if not empty. */
+  std::string logsDir; /**< The directory the logs of the robots are saved to at the end, if not empty. */
 
   friend class MultiImageSaveWidget;
 public:
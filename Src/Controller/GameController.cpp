@@ -12,6 +12,7 @@
 #include "Tools/Global.h"
 #include "Tools/Settings.h"
 #include "Tools/Streams/InStreams.h"
+#include "Tools/Streams/OutStreams.h"
 #include "Tools/Math/Eigen.h"
 #include <limits>
 #include <algorithm>
@@ -534,6 +535,10 @@ void GameController::referee()
 {
   SYNC;
 
+  if(!timeWhenRefereeStarted)
+    timeWhenRefereeStarted = Time::getCurrentSystemTime();
+  addEvents();
+
   if(automatic && lastState != STATE_SET && gameInfo.state == STATE_SET)
   {
     if(gameInfo.gamePhase != GAME_PHASE_PENALTYSHOOT)
@@ -737,6 +742,64 @@ GameController::BallOut GameController::updateBall()
   return result;
 }
 
+void GameController::addEvents()
+{
+  const unsigned time = Time::getTimeSince(timeWhenRefereeStarted);
+
+  const std::string stateDescription = gameInfo.getStateAsString();
+  if(stateDescription != lastStateDescription)
+  {
+    events.push_back({time, "state", stateDescription, -1});
+    lastStateDescription = stateDescription;
+  }
+
+  for(int team = 0; team < 2; ++team)
+    for(; lastScores[team] < teamInfos[team].score; ++lastScores[team])
+      events.push_back({time, "goal", std::to_string(team + 1), -1});
+
+  for(int i = 0; i < numOfRobots; ++i)
+  {
+    const Robot& r = robots[i];
+    if(r.simulatedRobot && r.info.penalty != r.lastPenalty)
+      events.push_back({time, "penalty",
+                        r.info.penalty == PENALTY_MANUAL ? "manual"
+                        : r.info.penalty == PENALTY_SUBSTITUTE ? "substitute"
+                        : r.info.penalty < numOfPenalties ? TypeRegistry::getEnumName(static_cast<Penalty>(r.info.penalty)) : "unknown",
+                        i});
+  }
+}
+
+bool GameController::writeSummary(const std::string& fileName)
+{
+  SYNC;
+  addEvents();
+
+  OutTextRawFile stream(fileName);
+  if(!stream.exists())
+    return false;
+
+  int penalties[2] = {0, 0};
+  for(const Event& event : events)
+    if(event.robot >= 0 && event.value != "none")
+      ++penalties[event.robot * 2 / numOfRobots];
+
+  stream << "{" << endl
+         << "  \"duration\": " << Time::getTimeSince(timeWhenRefereeStarted) << "," << endl
+         << "  \"score\": [" << static_cast<int>(teamInfos[0].score) << ", " << static_cast<int>(teamInfos[1].score) << "]," << endl
+         << "  \"penalties\": [" << penalties[0] << ", " << penalties[1] << "]," << endl
+         << "  \"events\": [";
+  for(const Event& event : events)
+  {
+    stream << (&event == &events.front() ? "" : ",") << endl
+           << "    {\"time\": " << event.time << ", \"type\": \"" << event.type << "\", \"value\": \"" << event.value << "\"";
+    if(event.robot >= 0)
+      stream << ", \"team\": " << event.robot * 2 / numOfRobots + 1 << ", \"number\": " << event.robot % (numOfRobots / 2) + 1;
+    stream << "}";
+  }
+  stream << endl << "  ]" << endl << "}" << endl;
+  return true;
+}
+
 void GameController::setLastBallContactRobot(SimRobot::Object* robot)
 {
   lastBallContactPose = Pose2f(SimulatedRobot::isFirstTeam(robot) ? pi : 0.f, SimulatedRobot::getPosition(robot));
@@ -7,6 +7,8 @@
 #pragma once
 
 #include <set>
+#include <string>
+#include <vector>
 #include <SimRobotCore2.h>
 #include "Platform/Thread.h"
 #include "Representations/Communication/GameInfo.h"
@@ -40,6 +42,15 @@ private:
     bool manuallyPlaced = false;
   };
 
+  /** An event of the game that is listed in the summary. */
+  struct Event
+  {
+    unsigned time; /**< The time of the event since the referee was started (in ms). */
+    const char* type; /**< "state", "goal", or "penalty". */
+    std::string value; /**< The new state, the team that scored, or the penalty. */
+    int robot; /**< The robot penalized [0 ... numOfRobots-1] or -1. */
+  };
+
   ENUM(Penalty,
   {,
     none,
@@ -81,6 +92,10 @@ private:
   unsigned timeWhenStateBegan = 0;
   unsigned timeWhenSetPlayBegan = 0;
   Robot robots[numOfRobots];
+  std::vector<Event> events; /**< The events of the game so far. */
+  unsigned timeWhenRefereeStarted = 0; /**< The time when the referee was executed the first time. */
+  std::string lastStateDescription; /**< The state (including set plays) when the referee was executed the last time. */
+  uint8_t lastScores[2] = {0, 0}; /**< The scores when the referee was executed the last time. */
 
   /** enum which declares the different types of balls leaving the field */
   enum BallOut
@@ -162,6 +177,14 @@ public:
    */
   void writeRobotInfo(int robot, Out& stream);
 
+  /**
+   * Writes a summary of the game in JSON format, i.e. the final score and
+   * all changes of the game state, goals, and penalties with their times.
+   * @param fileName The name of the file the summary is written to.
+   * @return Could the file be written?
+   */
+  bool writeSummary(const std::string& fileName);
+
   /**
    * Adds all commands of this module to the set of tab completion
    * strings.
@@ -286,4 +309,7 @@ private:
 
   /** Update the ball position based on the rules. */
   BallOut updateBall();
+
+  /** Adds the changes since the last call of the referee to the list of events. */
+  void addEvents();
 };
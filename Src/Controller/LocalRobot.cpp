@@ -11,6 +11,7 @@
 #include "Controller/ConsoleRoboCupCtrl.h"
 #include "Platform/Time.h"
 #include "Threads/Debug.h"
+#include <algorithm>
 
 LocalRobot::LocalRobot(Debug* debug) :
   RobotConsole(connectReceiverWithRobot(debug), connectSenderWithRobot(debug)),
@@ -46,8 +47,32 @@ LocalRobot::LocalRobot(Debug* debug) :
 
 bool LocalRobot::main()
 {
+  if(mode == SystemCall::logFileReplay && fastReplay)
+  {
+    // Only one thread can access *this now.
+    SYNC;
+
+    // The next frame is replayed as soon as all threads acknowledged their previous ones. A thread
+    // acknowledges a frame only after it sent its results to the other threads. Hence, they see
+    // the frames and the packets between them in the same order as on the robot.
+    if(std::all_of(threadData.begin(), threadData.end(), [](const auto& entry) {return entry.second.logAcknowledged;}))
+    {
+      const std::string threadIdentifier = logPlayer.getThreadIdentifierOfNextFrame();
+      if(threadIdentifier != "" && logPlayer.replay())
+      {
+        threadData[threadIdentifier].logAcknowledged = false;
+        debugSender->send(true);
+      }
+    }
+  }
+
   if(updateSignal.tryWait())
   {
+    // The image was only rendered by update(). It is converted here, i.e. concurrently
+    // with the other robots. update() does not access it before updatedSignal is posted.
+    SimulatedRobot::convertImage(renderedImage, cameraInfo, cameraImage);
+    renderedImage.clear();
+
     {
       // Only one thread can access *this now.
       SYNC;
@@ -122,11 +147,21 @@ bool LocalRobot::main()
   return true;
 }
 
-void LocalRobot::update()
+void LocalRobot::startRendering()
 {
-  RobotConsole::update();
+  // Only update() changes the mode and the time of the next image, i.e. this thread.
+  if(mode == SystemCall::simulatedRobot && ctrl->calculateImage && Time::getCurrentSystemTime() >= nextImageTimestamp)
+    simulatedRobot.startRendering();
+}
 
+void LocalRobot::join()
+{
   updatedSignal.wait();
+}
+
+void LocalRobot::update()
+{
+  RobotConsole::update();
 
   // Only one thread can access *this now.
   {
@@ -134,7 +169,8 @@ void LocalRobot::update()
 
     if(mode == SystemCall::logFileReplay)
     {
-      std::string threadIdentifier = logPlayer.getThreadIdentifierOfNextFrame();
+      // In fast mode, main() replays the frames.
+      std::string threadIdentifier = fastReplay ? "" : logPlayer.getThreadIdentifierOfNextFrame();
       if(threadIdentifier != "" && threadData[threadIdentifier].logAcknowledged && logPlayer.replay())
         threadData[threadIdentifier].logAcknowledged = false;
       if(puppet)
@@ -161,7 +197,8 @@ void LocalRobot::update()
     if(mode == SystemCall::simulatedRobot)
     {
       unsigned now = Time::getCurrentSystemTime();
-      if(now >= nextImageTimestamp)
+      const bool imageDue = now >= nextImageTimestamp;
+      if(imageDue)
       {
         unsigned newNextImageTimestamp = ctrl->globalNextImageTimestamp;
         if(newNextImageTimestamp == nextImageTimestamp)
@@ -173,19 +210,15 @@ void LocalRobot::update()
         }
         nextImageTimestamp = newNextImageTimestamp;
 
+        // Usually, the rendering was already started before the robots were joined.
         if(ctrl->calculateImage)
-          simulatedRobot.getImage(cameraImage, cameraInfo);
+          simulatedRobot.startRendering();
         else
-        {
           simulatedRobot.getCameraInfo(cameraInfo);
-          cameraImage.timestamp = now;
-        }
-        simulatedRobot.getRobotPose(robotPose);
+        cameraImage.timestamp = now;
         simulatedRobot.getWorldState(worldState);
-        simulatedRobot.toggleCamera();
       }
-      else
-        simulatedRobot.getRobotPose(robotPose);
+      simulatedRobot.getRobotPose(robotPose);
 
       if(jointCalibrationChanged)
       {
@@ -195,8 +228,14 @@ void LocalRobot::update()
       simulatedRobot.getOdometryData(robotPose, odometryData);
       simulatedRobot.getSensorData(fsrSensorData, inertialSensorData);
       simulatedRobot.getAndSetJointData(jointRequest, jointSensorData);
-    }
 
+      if(imageDue)
+      {
+        if(ctrl->calculateImage)
+          simulatedRobot.renderImage(renderedImage, cameraInfo);
+        simulatedRobot.toggleCamera();
+      }
+    }
     QString statusText;
     if(mode == SystemCall::logFileReplay)
     {
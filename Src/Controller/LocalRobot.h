@@ -31,6 +31,7 @@ class LocalRobot : public RobotConsole
 {
 private:
   CameraImage cameraImage; /**< The simulated camera image sent to the robot code. */
+  std::vector<unsigned char> renderedImage; /**< The RGB image rendered by the simulation that is converted to cameraImage by main(). */
   CameraInfo cameraInfo; /**< The information about the camera that took the image sent to the robot code. */
   JointSensorData jointSensorData; /**< The simulated joint measurements sent to the robot code. */
   FsrSensorData fsrSensorData; /**< The simulated inertia sensor data sent to the robot code. */
@@ -58,9 +59,25 @@ public:
    */
   bool main() override;
 
+  /**
+   * The function starts rendering the camera images of all robots if an image of this
+   * robot is due in the current simulation step. It is called for all robots before
+   * they are joined, so the images are read back while their threads are still busy.
+   * It does not access data that main() uses.
+   */
+  void startRendering();
+
+  /**
+   * The function waits until main() has sent the data of the previous call to update().
+   * It must be called before update(). The robots are joined before any of them
+   * accesses the simulation again, so that they can process their data concurrently.
+   */
+  void join();
+
   /**
    * The function must be called to exchange data with SimRobot.
    * It sends the motor commands to SimRobot and acquires new sensor data.
+   * Afterwards, main() is triggered to convert and send the data to the robot code.
    */
   void update() override;
 
@@ -36,6 +36,7 @@
 #include "Tools/Logging/LoggingTools.h"
 #include "Tools/Math/Transformation.h"
 #include "Tools/Motion/SensorData.h"
+#include "Tools/Parallel.h"
 #include "Tools/Streams/TypeInfo.h"
 #include <QImage>
 #include <QDir>
@@ -271,6 +272,43 @@ bool LogExtractor::saveImages(const std::string& path, const bool raw, const boo
 
   const CRCLut crcLut;
 
+  const auto writeImage = [&crcLut, raw](const CameraImage& image, const std::string& filename, const CameraInfo& cameraInfo,
+                                         const CameraMatrix& cameraMatrix, const ImageCoordinateSystem& imageCoordinateSystem)
+  {
+    // Open PNG file
+    QFile qfile(filename.c_str());
+    qfile.open(QIODevice::WriteOnly);
+
+    // Write image
+    image.exportImage(qfile, raw ? YUYVImage::raw : YUYVImage::rgb);
+
+    // Remove IEND chunk
+    qfile.resize(qfile.size() - 12);
+
+    // Write metadata
+    OutBinaryMemory metaData;
+    metaData << cameraInfo;
+    metaData << cameraMatrix;
+    metaData << imageCoordinateSystem;
+    const unsigned int size = static_cast<unsigned int>(metaData.size());
+    for(size_t i = 0; i < 4; i++)
+      qfile.putChar(reinterpret_cast<const char*>(&size)[3 - i]);
+    qfile.write("bhMn");
+    qfile.write(metaData.data(), metaData.size());
+    const unsigned int crc = CRC().update(crcLut, "bhMn", 4).update(crcLut, metaData.data(), metaData.size()).finish();
+    for(size_t i = 0; i < 4; i++)
+      qfile.putChar(reinterpret_cast<const char*>(&crc)[3 - i]);
+
+    // Write IEND chunk
+    const std::array<char, 12> endChunk{ 0, 0, 0, 0, 'I', 'E', 'N', 'D', char(0xae), char(0x42), char(0x60), char(0x82) };
+    qfile.write(endChunk.data(), endChunk.size());
+    qfile.close();
+  };
+
+  // Images are decoded and written in the background while the log is read further.
+  Parallel::Workers workers;
+  JPEGImage jpegImage; // The last JPEG image not exported yet. It is decoded by a worker.
+
   int skippedImageCount = 0;
 
   // Use DECLARE_REPRESENTATIONS_AND_MAP as soon as the hack is no longer needed
@@ -287,16 +325,14 @@ bool LogExtractor::saveImages(const std::string& path, const bool raw, const boo
 
     if(theJPEGImage.timestamp)
     {
-      theJPEGImage.toCameraImage(theCameraImage); // Assume that CameraImage and JPEGImage are not logged at the same time.
+      // Assume that CameraImage and JPEGImage are not logged at the same time.
+      // Therefore, theCameraImage only tracks the timestamp of the JPEG image.
+      jpegImage = theJPEGImage;
+      theCameraImage.timestamp = theJPEGImage.timestamp;
       theJPEGImage.timestamp = 0;
     }
 
-    CameraImage* imageToExport = nullptr;
-
     if(theCameraImage.timestamp)
-      imageToExport = &theCameraImage;
-
-    if(imageToExport)
     {
       // Frame skipping: only count frames if they are from the upper camera so
       // that always a pair of lower and upper frames is saved
@@ -305,36 +341,23 @@ bool LogExtractor::saveImages(const std::string& path, const bool raw, const boo
       if(skippedImageCount != 0)
         return true;
 
-      // Open PNG file
-      const std::string filename = CameraImage::expandImageFileName(folderPath + (theCameraInfo.camera == CameraInfo::upper ? "upper" : "lower"), imageToExport->timestamp);
-      QFile qfile(filename.c_str());
-      qfile.open(QIODevice::WriteOnly);
-
-      // Write image
-      imageToExport->exportImage(qfile, raw ? YUYVImage::raw : YUYVImage::rgb);
-      imageToExport->timestamp = 0;
-
-      // Remove IEND chunk
-      qfile.resize(qfile.size() - 12);
-
-      // Write metadata
-      OutBinaryMemory metaData;
-      metaData << theCameraInfo;
-      metaData << theCameraMatrix;
-      metaData << theImageCoordinateSystem;
-      const unsigned int size = static_cast<unsigned int>(metaData.size());
-      for(size_t i = 0; i < 4; i++)
-        qfile.putChar(reinterpret_cast<const char*>(&size)[3 - i]);
-      qfile.write("bhMn");
-      qfile.write(metaData.data(), metaData.size());
-      const unsigned int crc = CRC().update(crcLut, "bhMn", 4).update(crcLut, metaData.data(), metaData.size()).finish();
-      for(size_t i = 0; i < 4; i++)
-        qfile.putChar(reinterpret_cast<const char*>(&crc)[3 - i]);
-
-      // Write IEND chunk
-      const std::array<char, 12> endChunk{ 0, 0, 0, 0, 'I', 'E', 'N', 'D', char(0xae), char(0x42), char(0x60), char(0x82) };
-      qfile.write(endChunk.data(), endChunk.size());
-      qfile.close();
+      // Logs can contain both formats, e.g. if "log jpeg" was toggled during recording.
+      // A raw image replaces the timestamp, so the image to export is from the last JPEG only if it still matches.
+      const bool fromJPEG = jpegImage.timestamp && jpegImage.timestamp == theCameraImage.timestamp;
+      const std::string filename = CameraImage::expandImageFileName(folderPath + (theCameraInfo.camera == CameraInfo::upper ? "upper" : "lower"), theCameraImage.timestamp);
+      if(fromJPEG)
+        workers.add([&writeImage, filename, jpegImage, cameraInfo = theCameraInfo, cameraMatrix = theCameraMatrix, imageCoordinateSystem = theImageCoordinateSystem]
+        {
+          CameraImage cameraImage;
+          jpegImage.toCameraImage(cameraImage);
+          writeImage(cameraImage, filename, cameraInfo, cameraMatrix, imageCoordinateSystem);
+        });
+      else
+        workers.add([&writeImage, filename, cameraImage = theCameraImage, cameraInfo = theCameraInfo, cameraMatrix = theCameraMatrix, imageCoordinateSystem = theImageCoordinateSystem]
+        {
+          writeImage(cameraImage, filename, cameraInfo, cameraMatrix, imageCoordinateSystem);
+        });
+      theCameraImage.timestamp = 0;
     }
 
     return true;
@@ -505,6 +528,18 @@ bool LogExtractor::saveLabeledBallSpots(const std::string& path)
   });
   BallSpecification ballSpecification;
 
+  /** A patch that is extracted from an image and saved. */
+  struct Patch
+  {
+    Vector2i center;
+    Vector2i size;
+    std::string fileName;
+  };
+
+  // The CSV file is written in the order of the log, but the images are decoded
+  // and the patches are saved in the background.
+  Parallel::Workers workers;
+
   int imageNumber = 0;
                     const std::string& folderPath = createNewFolder(path.substr(0, path.rfind(".")) + "/");
 
@@ -518,10 +553,10 @@ bool LogExtractor::saveLabeledBallSpots(const std::string& path)
   {
     if(theLabelImage.valid)
     {
+      std::vector<Patch> patches;
       for(const Vector2i& ballSpot : theBallSpots.ballSpots)
       {
         std::stringstream ss;
-        GrayscaledImage dest;
         bool foundIgnoreAnnotation = false;
         std::vector< std::vector<int> > labels = { { 0, 0, 0 }, { 0, 0, 0 }, { 0, 1, 1, 0 }, { 0, 1, 1, 0 } };
 
@@ -572,10 +607,7 @@ bool LogExtractor::saveLabeledBallSpots(const std::string& path)
           Vector2f ballSpotOnField;
           if(!Transformation::imageToRobotHorizontalPlane(ballSpot.cast<float>(), ballSpecification.radius, theCameraMatrix, theCameraInfo, ballSpotOnField))
             continue;
-          CameraImage cameraImage;
-          theJPEGImage.toCameraImage(cameraImage);
-          PatchUtilities::extractPatch(ballSpot, Vector2i(diameter, diameter), Vector2i(32, 32), cameraImage.getGrayscaled(), dest);
-          dest.exportImage(ss.str(), theLabelImage.frameTime, GrayscaledImage::grayscale);
+          patches.push_back({ballSpot, Vector2i(diameter, diameter), ss.str()});
           file << imageNumber << sep
                << theLabelImage.frameTime << sep
                << theCameraInfo.camera << sep
@@ -594,6 +626,20 @@ bool LogExtractor::saveLabeledBallSpots(const std::string& path)
           imageNumber++;
         }
       }
+
+      if(!patches.empty())
+        workers.add([patches = std::move(patches), jpegImage = theJPEGImage, frameTime = theLabelImage.frameTime]
+        {
+          CameraImage cameraImage;
+          jpegImage.toCameraImage(cameraImage);
+          const GrayscaledImage grayscaled = cameraImage.getGrayscaled();
+          for(const Patch& patch : patches)
+          {
+            GrayscaledImage dest;
+            PatchUtilities::extractPatch(patch.center, patch.size, Vector2i(32, 32), grayscaled, dest);
+            dest.exportImage(patch.fileName, frameTime, GrayscaledImage::grayscale);
+          }
+        });
     }
     return true;
   },
@@ -16,6 +16,7 @@
 #include "Representations/Modeling/LabelImage.h"
 #include "Tools/Debugging/DebugImages.h"
 #include "Tools/Logging/LoggingTools.h"
+#include "Tools/Parallel.h"
 
 #include <snappy-c.h>
 
@@ -73,32 +74,56 @@ bool LogPlayer::open(const std::string& fileName)
         file >> *this;
         break;
       case LoggingTools::logFileCompressed: //compressed log file
-        while(!file.eof())
+      {
+        // The blocks are read in batches that are decompressed in parallel and then appended in their original order.
+        std::vector<std::vector<char>> compressedBuffers(Parallel::numOfThreads());
+        std::vector<std::vector<char>> uncompressedBuffers(compressedBuffers.size());
+        std::vector<size_t> uncompressedSizes(compressedBuffers.size());
+        bool success = true;
+        while(success && !file.eof())
         {
-          unsigned compressedSize;
-          file >> compressedSize;
-          ASSERT(compressedSize > 0);
-          std::vector<char> compressedBuffer;
-          compressedBuffer.resize(compressedSize);
-          file.read(&compressedBuffer[0], compressedSize);
-
-          size_t uncompressedSize = 0;
-          snappy_uncompressed_length(&compressedBuffer[0], compressedSize, &uncompressedSize);
-          std::vector<char> uncompressBuffer;
-          uncompressBuffer.resize(uncompressedSize);
-          if(snappy_uncompress(&compressedBuffer[0], compressedSize, &uncompressBuffer[0], &uncompressedSize) != SNAPPY_OK)
-            break;
-          InBinaryMemory mem(&uncompressBuffer[0], uncompressedSize);
-          mem >> *this;
+          size_t numOfBlocks = 0;
+          for(; numOfBlocks < compressedBuffers.size() && !file.eof(); ++numOfBlocks)
+          {
+            unsigned compressedSize;
+            file >> compressedSize;
+            ASSERT(compressedSize > 0);
+            compressedBuffers[numOfBlocks].resize(compressedSize);
+            file.read(compressedBuffers[numOfBlocks].data(), compressedSize);
+          }
+
+          Parallel::forEach(numOfBlocks, [&](size_t block)
+          {
+            const std::vector<char>& compressedBuffer = compressedBuffers[block];
+            size_t& uncompressedSize = uncompressedSizes[block];
+            if(snappy_uncompressed_length(compressedBuffer.data(), compressedBuffer.size(), &uncompressedSize) != SNAPPY_OK)
+              uncompressedSize = 0;
+            else
+            {
+              uncompressedBuffers[block].resize(uncompressedSize);
+              if(snappy_uncompress(compressedBuffer.data(), compressedBuffer.size(), uncompressedBuffers[block].data(), &uncompressedSize) != SNAPPY_OK)
+                uncompressedSize = 0;
+            }
+          });
+
+          // Everything behind a block that could not be decompressed is ignored.
+          for(size_t block = 0; success && block < numOfBlocks; ++block)
+            if(uncompressedSizes[block])
+            {
+              InBinaryMemory mem(uncompressedBuffers[block].data(), uncompressedSizes[block]);
+              mem >> *this;
+            }
+            else
+              success = false;
         }
         break;
+      }
       default:
         logfilePath = "";
         return false; //unknown magic byte
     }
 
     stop();
-    countFrames();
     createIndices();
     upgradeFrames();
     loadLabels();
@@ -244,6 +269,7 @@ int LogPlayer::getFrameForRemainingGCTime(int time)
 
 void LogPlayer::recordStart()
 {
+  queue.freeIndex(); // Messages cannot be added while there is an index.
   state = recording;
 }
 
@@ -251,6 +277,7 @@ void LogPlayer::recordStop()
 {
   while(getNumberOfMessages() > numberOfMessagesWithinCompleteFrames)
     removeLastMessage();
+  createIndices();
   currentMessageNumber = -1;
   currentFrameNumber = -1;
   state = initial;
@@ -318,87 +345,67 @@ bool LogPlayer::replay()
 void LogPlayer::keep(const std::function<bool(InMessage&)>& filter)
 {
   stop();
-  LogPlayer temp(static_cast<MessageQueue&>(*this));
-  temp.setSize(queue.getSize());
-  moveAllMessages(temp);
-  for(temp.currentMessageNumber = 0; temp.currentMessageNumber < temp.getNumberOfMessages(); ++temp.currentMessageNumber)
+  queue.createIndex();
+  std::vector<bool> keepMessage(getNumberOfMessages());
+  for(int i = 0; i < getNumberOfMessages(); ++i)
   {
-    temp.queue.setSelectedMessageForReading(temp.currentMessageNumber);
-    temp.in.text.reset();
-    if(filter(temp.in))
-      temp.copyMessage(temp.currentMessageNumber, *this);
+    queue.setSelectedMessageForReading(i);
+    in.text.reset();
+    keepMessage[i] = filter(in);
   }
-  countFrames();
-  if(!frameIndex.empty())
-    createIndices();
+  keepMessages(keepMessage);
 }
 
 void LogPlayer::keepFrames(const std::function<bool(InMessage&)>& filter)
 {
   stop();
-  LogPlayer temp(static_cast<MessageQueue&>(*this));
-  temp.setSize(queue.getSize());
-  moveAllMessages(temp);
-  temp.queue.createIndex();
+  queue.createIndex();
+  std::vector<bool> keepMessage(getNumberOfMessages());
   int frameStart = -1;
   bool keepFrame = false;
-  for(temp.currentMessageNumber = 0; temp.currentMessageNumber < temp.getNumberOfMessages(); ++temp.currentMessageNumber)
+  for(int i = 0; i < getNumberOfMessages(); ++i)
   {
-    temp.queue.setSelectedMessageForReading(temp.currentMessageNumber);
-    temp.in.text.reset();
-    keepFrame |= filter(temp.in);
-    if(temp.queue.getMessageID() == idFrameBegin)
+    queue.setSelectedMessageForReading(i);
+    in.text.reset();
+    keepFrame |= filter(in);
+    if(queue.getMessageID() == idFrameBegin)
     {
-      frameStart = temp.currentMessageNumber;
+      frameStart = i;
       keepFrame = false;
     }
-    else if(temp.queue.getMessageID() == idFrameFinished && keepFrame)
+    else if(queue.getMessageID() == idFrameFinished && keepFrame)
     {
-      int thisFrame = temp.currentMessageNumber;
-      for(temp.currentMessageNumber = frameStart; temp.currentMessageNumber <= thisFrame; ++temp.currentMessageNumber)
-        temp.copyMessage(temp.currentMessageNumber, *this);
-      temp.currentMessageNumber = thisFrame;
+      if(frameStart != -1)
+        std::fill(keepMessage.begin() + frameStart, keepMessage.begin() + i + 1, true);
       keepFrame = false;
     }
   }
-  countFrames();
-  if(!frameIndex.empty())
-    createIndices();
+  keepMessages(keepMessage);
 }
 
 void LogPlayer::trim(int startFrame, int endFrame)
 {
   stop();
-  LogPlayer temp(static_cast<MessageQueue&>(*this));
-  temp.setSize(queue.getSize());
-  moveAllMessages(temp);
-  temp.queue.createIndex();
-
-  for(int i = frameIndex[startFrame]; i < frameIndex[endFrame]; i++)
-  {
-    temp.copyMessage(i, *this);
-  }
-
-  countFrames();
-  if(!frameIndex.empty())
-    createIndices();
+  std::vector<bool> keepMessage(getNumberOfMessages());
+  std::fill(keepMessage.begin() + frameIndex[startFrame], keepMessage.begin() + frameIndex[endFrame], true);
+  keepMessages(keepMessage);
 }
 
 void LogPlayer::keep(const std::vector<int>& messageNumbers)
 {
   stop();
-  LogPlayer temp(static_cast<MessageQueue&>(*this));
-  temp.setSize(queue.getSize());
-  moveAllMessages(temp);
+  std::vector<bool> keepMessage(getNumberOfMessages());
+  for(int messageNumber : messageNumbers)
+    keepMessage[messageNumber] = true;
+  keepMessages(keepMessage);
+}
 
-  for(auto& messageNumber : messageNumbers)
-  {
-    temp.queue.setSelectedMessageForReading(messageNumber);
-    temp.copyMessage(messageNumber, *this);
-  }
-  countFrames();
-  if(!frameIndex.empty())
-    createIndices();
+void LogPlayer::keepMessages(const std::vector<bool>& keepMessage)
+{
+  ASSERT(static_cast<int>(keepMessage.size()) == getNumberOfMessages());
+  queue.freeIndex();
+  LoggingTools::keepMessages(*this, keepMessage);
+  createIndices();
 }
 
 void LogPlayer::statistics(int frequencies[numOfDataMessageIDs], unsigned* sizes,
@@ -415,22 +422,55 @@ void LogPlayer::statistics(int frequencies[numOfDataMessageIDs], unsigned* sizes
 
   if(getNumberOfMessages() > 0)
   {
-    int current = queue.getSelectedMessageForReading();
-    std::string currentThread;
-    for(int i = 0; i < getNumberOfMessages(); ++i)
+    if(!queue.messageIndex)
+      queue.createIndex();
+
+    struct Histogram
+    {
+      std::array<int, numOfDataMessageIDs> frequencies{};
+      std::array<unsigned, numOfDataMessageIDs> sizes{};
+    };
+
+    const std::vector<int> chunks = getChunks();
+    std::vector<Histogram> histograms(chunks.size() - 1);
+    Parallel::forEach(histograms.size(), [&](size_t chunk)
     {
-      queue.setSelectedMessageForReading(i);
-      ASSERT(queue.getMessageID() < numOfDataMessageIDs);
-      if(queue.getMessageID() == idFrameBegin)
-        currentThread = in.readThreadIdentifier();
-      if(threadIdentifier.empty() || threadIdentifier == currentThread)
+      Histogram& histogram = histograms[chunk];
+
+      // A chunk continues the frame that was begun last before it.
+      std::string currentThread;
+      if(!threadIdentifier.empty())
+        for(int i = chunks[chunk] - 1; i >= 0; --i)
+        {
+          const Message message = getMessage(i);
+          if(message.id == idFrameBegin)
+          {
+            currentThread = getThreadIdentifier(message);
+            break;
+          }
+        }
+
+      for(int i = chunks[chunk]; i < chunks[chunk + 1]; ++i)
+      {
+        const Message message = getMessage(i);
+        ASSERT(message.id < numOfDataMessageIDs);
+        if(message.id == idFrameBegin && !threadIdentifier.empty())
+          currentThread = getThreadIdentifier(message);
+        if(threadIdentifier.empty() || threadIdentifier == currentThread)
+        {
+          ++histogram.frequencies[message.id];
+          histogram.sizes[message.id] += message.size + 4;
+        }
+      }
+    });
+
+    for(const Histogram& histogram : histograms)
+      FOREACH_ENUM(MessageID, id, numOfDataMessageIDs)
       {
-        ++frequencies[queue.getMessageID()];
+        frequencies[id] += histogram.frequencies[id];
         if(sizes)
-          sizes[queue.getMessageID()] += queue.getMessageSize() + 4;
+          sizes[id] += histogram.sizes[id];
       }
-    }
-    queue.setSelectedMessageForReading(current);
   }
 }
 
@@ -441,42 +481,104 @@ void LogPlayer::createIndices()
   gameInfoSize << gameInfo;
 
   queue.createIndex();
-  frameIndex.clear();
-  frameIndex.reserve(numberOfFrames);
-  gcTimeIndex.fill(-1);
-  int frame = 0;
-  for(int i = 0; i < getNumberOfMessages(); ++i)
+
+  // Each chunk is indexed separately. Its frame numbers are relative to the frames finished before it.
+  struct ChunkIndex
   {
-    queue.setSelectedMessageForReading(i);
-    const MessageID id = queue.getMessageID();
-    if(id == idFrameBegin)
-      frameIndex.push_back(i);
-    else if(id == idGameInfo && queue.getMessageSize() == static_cast<int>(gameInfoSize.size()))
+    std::vector<int> frameIndex;
+    std::vector<std::pair<int, int>> gcTimes; /**< Pairs of remaining times and relative frame numbers. */
+    int numberOfFrames = 0;
+    int lastFrameFinished = -1;
+  };
+
+  const std::vector<int> chunks = getChunks();
+  std::vector<ChunkIndex> chunkIndices(chunks.size() - 1);
+  Parallel::forEach(chunkIndices.size(), [&](size_t chunk)
+  {
+    ChunkIndex& chunkIndex = chunkIndices[chunk];
+    for(int i = chunks[chunk]; i < chunks[chunk + 1]; ++i)
     {
-      in.bin >> gameInfo;
-      const int time = gameInfo.secsRemaining;
-      if(time >= 0 && time < static_cast<int>(gcTimeIndex.size()) && gcTimeIndex[time] == -1)
+      const Message message = getMessage(i);
+      if(message.id == idFrameBegin)
+        chunkIndex.frameIndex.push_back(i);
+      else if(message.id == idGameInfo && message.size == static_cast<int>(gameInfoSize.size()))
       {
-        gcTimeIndex[time] = frame;
+        GameInfo gameInfo;
+        InBinaryMemory stream(message.data, message.size);
+        stream >> gameInfo;
+        const int time = gameInfo.secsRemaining;
+        if(time >= 0 && time < static_cast<int>(gcTimeIndex.size()))
+          chunkIndex.gcTimes.emplace_back(time, chunkIndex.numberOfFrames);
+      }
+      else if(message.id == idFrameFinished)
+      {
+        ++chunkIndex.numberOfFrames;
+        chunkIndex.lastFrameFinished = i;
       }
     }
-    else if(id == idFrameFinished)
-      ++frame;
+  });
+
+  numberOfFrames = 0;
+  numberOfMessagesWithinCompleteFrames = 0;
+  frameIndex.clear();
+  gcTimeIndex.fill(-1);
+  for(const ChunkIndex& chunkIndex : chunkIndices)
+  {
+    frameIndex.insert(frameIndex.end(), chunkIndex.frameIndex.begin(), chunkIndex.frameIndex.end());
+    for(const auto& [time, frame] : chunkIndex.gcTimes)
+      if(gcTimeIndex[time] == -1)
+        gcTimeIndex[time] = numberOfFrames + frame;
+    numberOfFrames += chunkIndex.numberOfFrames;
+    if(chunkIndex.lastFrameFinished != -1)
+      numberOfMessagesWithinCompleteFrames = chunkIndex.lastFrameFinished + 1;
   }
 }
 
-void LogPlayer::countFrames()
+std::vector<int> LogPlayer::getChunks() const
 {
-  numberOfFrames = 0;
-  for(int i = 0; i < getNumberOfMessages(); ++i)
+  // More chunks than threads balance the load, but each should still be worth starting.
+  const int numOfChunks = std::max(1, std::min(static_cast<int>(Parallel::numOfThreads()) * 4, getNumberOfMessages() / 1024));
+  std::vector<int> chunks(numOfChunks + 1);
+  for(int i = 0; i <= numOfChunks; ++i)
+    chunks[i] = static_cast<int>(static_cast<long long>(getNumberOfMessages()) * i / numOfChunks);
+  return chunks;
+}
+
+LogPlayer::Message LogPlayer::getMessage(int message) const
+{
+  ASSERT(queue.messageIndex);
+  ASSERT(message >= 0 && message < queue.numberOfMessages);
+  char* header = queue.buf + queue.messageIndex[message];
+  const MessageID id = static_cast<MessageID>(static_cast<unsigned char>(header[0]));
+  return
   {
-    queue.setSelectedMessageForReading(i);
+    id < queue.numOfMappedIDs ? queue.mappedIDs[id] : id,
+    header + MessageQueueBase::headerSize,
+    *reinterpret_cast<int*>(header + 1) & 0xffffff
+  };
+}
 
-    if(queue.getMessageID() == idFrameFinished)
+std::string LogPlayer::getThreadIdentifier(const Message& message)
+{
+  ASSERT(message.id == idFrameBegin || message.id == idFrameFinished);
+  if(message.size == 1)
+    switch(message.data[0])
     {
-      ++numberOfFrames;
-      numberOfMessagesWithinCompleteFrames = i + 1;
+      case 'c':
+        return "Upper";
+      case 'd':
+        return "Lower";
+      case 'm':
+        return "Motion";
+      default:
+        return "";
     }
+  else
+  {
+    std::string threadIdentifier;
+    InBinaryMemory stream(message.data, message.size);
+    stream >> threadIdentifier;
+    return threadIdentifier;
   }
 }
 
@@ -527,7 +629,6 @@ void LogPlayer::loadLabels()
       cognitionLog.setSize(queue.getSize());
 
       moveAllMessages(cognitionLog);
-      cognitionLog.countFrames();
       cognitionLog.createIndices();
 
       struct FrameData
@@ -614,7 +715,6 @@ void LogPlayer::loadLabels()
           ++cognitionItr;
         }
       }
-      countFrames();
       createIndices();
     }
   }
@@ -639,41 +739,43 @@ std::string LogPlayer::getThreadIdentifierOfNextFrame()
 
 void LogPlayer::upgradeFrames()
 {
-  int beginOfFrame = -1;
-  bool rename = false;
-  for(int i = 0; i < getNumberOfMessages(); ++i)
+  // Frames are independent from each other and renaming does not change the layout of the queue.
+  Parallel::forEach(frameIndex.size(), [&](size_t frame)
   {
-    queue.setSelectedMessageForReading(i);
-    switch(in.getMessageID())
+    const Message frameBegin = getMessage(frameIndex[frame]);
+    if(getThreadIdentifier(frameBegin) != "Upper")
+      return;
+
+    bool rename = false;
+    for(int i = frameIndex[frame] + 1; i < getNumberOfMessages(); ++i)
     {
-      case idFrameBegin:
-        beginOfFrame = in.readThreadIdentifier() == "Upper" ? i : -1;
-        rename = false;
-        break;
-      case idCameraInfo:
-        if(beginOfFrame != -1)
-        {
-          CameraInfo cameraInfo;
-          in.bin >> cameraInfo;
-          rename = cameraInfo.camera == CameraInfo::lower;
-        }
-        break;
-      case idFrameFinished:
+      const Message message = getMessage(i);
+      if(message.id == idFrameBegin)
+        return;
+      else if(message.id == idCameraInfo)
+      {
+        CameraInfo cameraInfo;
+        InBinaryMemory stream(message.data, message.size);
+        stream >> cameraInfo;
+        rename = cameraInfo.camera == CameraInfo::lower;
+      }
+      else if(message.id == idFrameFinished)
+      {
         if(rename)
         {
-          if(queue.getData()[0] == 'c')
-          {
-            const_cast<char&>(queue.getData()[0]) = 'd';
-            queue.setSelectedMessageForReading(beginOfFrame);
-            const_cast<char&>(queue.getData()[0]) = 'd';
-          }
+          // Both thread identifiers are either abbreviated or "Upper", which has the same length as "Lower".
+          if(message.data[0] == 'c')
+            message.data[0] = frameBegin.data[0] = 'd';
           else
-          {
-            patchMessage(i, 0, "Lower");
-            patchMessage(beginOfFrame, 0, "Lower");
-          }
+            for(const Message& patch : {message, frameBegin})
+            {
+              ASSERT(patch.size == 9);
+              OutBinaryMemory stream(patch.size, patch.data);
+              stream << std::string("Lower");
+            }
         }
-      default: ;
+        return;
+      }
     }
-  }
+  });
 }
@@ -152,6 +152,7 @@ public:
 
   /**
    * The function filters the message queue by message numbers.
+   * The messages keep their order.
    * @param savedMessages Vector of message numbers that should be kept.
    */
   void keep(const std::vector<int>& savedMessages);
@@ -186,16 +187,50 @@ public:
 
 private:
   /**
-   * The method counts the number of frames.
+   * A message of the queue that is accessed directly, i.e. without selecting it
+   * for reading. Therefore, several threads can access messages at the same time.
    */
-  void countFrames();
+  struct Message
+  {
+    MessageID id; /**< The id of the message. */
+    char* data; /**< The address of the data of the message. */
+    int size; /**< The size of the data in bytes. */
+  };
 
   /**
-   * Creates the index of the first message numbers of all frames as well as the
-   * index of frames corresponding to Game Controller times.
+   * Counts the frames and creates the index of the first message numbers of all
+   * frames as well as the index of frames corresponding to Game Controller times.
+   * The messages are processed in parallel chunks.
    */
   void createIndices();
 
   /** Renames all frames called "Upper" that contain lower camera data to "Lower". */
   void upgradeFrames();
+
+  /**
+   * Removes messages from the queue and updates the indices. The remaining
+   * messages are only copied if activation graphs must be rewritten.
+   * @param keepMessage Which messages should be kept? Has an entry per message.
+   */
+  void keepMessages(const std::vector<bool>& keepMessage);
+
+  /**
+   * Splits the messages into chunks that can be processed in parallel.
+   * @return The first message numbers of all chunks followed by the number of messages.
+   */
+  std::vector<int> getChunks() const;
+
+  /**
+   * Returns a message without selecting it for reading. The index of the queue must exist.
+   * @param message The number of the message.
+   * @return The message.
+   */
+  Message getMessage(int message) const;
+
+  /**
+   * Returns the thread identifier of a message.
+   * @param message An idFrameBegin or idFrameFinished message.
+   * @return The thread identifier.
+   */
+  static std::string getThreadIdentifier(const Message& message);
 };
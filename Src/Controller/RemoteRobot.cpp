@@ -7,6 +7,7 @@
 #include "RemoteRobot.h"
 #include "ConsoleRoboCupCtrl.h"
 #include "Platform/Time.h"
+#include <snappy-c.h>
 
 RemoteRobot::RemoteRobot(const std::string& name, const std::string& ip) :
   RobotConsole(nullptr, nullptr), name(name), ip(ip)
@@ -62,12 +63,25 @@ bool RemoteRobot::main()
   if(sendSize)
     delete[] sendData;
 
-  // If a packet was received from the router program, add it to receiver queue
+  // If a packet was received from the robot, decompress it and add it to receiver queue
   if(receivedSize > 0)
   {
-    SYNC;
-    InBinaryMemory stream(receivedData, receivedSize);
-    stream >> *debugReceiver;
+    size_t uncompressedSize = 0;
+    if(snappy_uncompressed_length(reinterpret_cast<char*>(receivedData), receivedSize, &uncompressedSize) != SNAPPY_OK)
+      printLn("Error: RemoteRobot: Cannot determine the size of a packet of " + std::to_string(receivedSize) + " bytes. Packet dropped.");
+    else
+    {
+      if(uncompressedBuffer.size() < uncompressedSize)
+        uncompressedBuffer.resize(uncompressedSize);
+      if(snappy_uncompress(reinterpret_cast<char*>(receivedData), receivedSize, uncompressedBuffer.data(), &uncompressedSize) != SNAPPY_OK)
+        printLn("Error: RemoteRobot: Cannot decompress a packet of " + std::to_string(receivedSize) + " bytes. Packet dropped.");
+      else
+      {
+        SYNC;
+        InBinaryMemory stream(uncompressedBuffer.data(), uncompressedSize);
+        stream >> *debugReceiver;
+      }
+    }
     delete[] receivedData;
   }
 
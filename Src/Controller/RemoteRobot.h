@@ -9,6 +9,7 @@
 #include "Tools/Debugging/TcpConnection.h"
 #include "RobotConsole.h"
 #include "SimulatedRobot.h"
+#include <vector>
 
 /**
  * @class RemoteRobot
@@ -25,6 +26,7 @@ private:
   unsigned timestamp = 0; /**< The time when the transfer speed was measured. */
   SimulatedRobot simulatedRobot; /**< The interface to simulated objects. */
   SimRobotCore2::Body* puppet; /**< A pointer to the puppet when there is one. Otherwise 0. */
+  std::vector<char> uncompressedBuffer; /**< The packets received are decompressed into this buffer. */
 
 public:
   /**
@@ -10,6 +10,7 @@
 #include "Tools/MessageQueue/InMessage.h"
 #include "Platform/Time.h"
 #include "Platform/BHAssert.h"
+#include <algorithm>
 #include <iostream>
 
 void TimeInfo::reset()
@@ -53,7 +54,11 @@ bool TimeInfo::handleMessage(InMessage& message, bool justReadNames)
       message.bin >> watchId;
       message.bin >> time;
       if(!justReadNames)
+      {
         infos[watchId].push_front(static_cast<float>(time));
+        if(recording)
+          recorded[watchId].push_back(time);
+      }
       infos[watchId].timestamp = Time::getCurrentSystemTime();
     }
 
@@ -89,6 +94,22 @@ void TimeInfo::getStatistics(const Info& info, float& minTime, float& maxTime, f
   maxTime = info.maximum() / 1000.0f;
 }
 
+TimeInfo::Distribution TimeInfo::getDistribution(unsigned short watchId) const
+{
+  Distribution distribution;
+  const auto i = recorded.find(watchId);
+  if(i != recorded.end() && !i->second.empty())
+  {
+    std::vector<unsigned> times = i->second;
+    std::sort(times.begin(), times.end());
+    distribution.count = times.size();
+    distribution.median = static_cast<float>(times[times.size() / 2]) / 1000.f;
+    distribution.percentile95 = static_cast<float>(times[times.size() * 95 / 100]) / 1000.f;
+    distribution.maximum = static_cast<float>(times.back()) / 1000.f;
+  }
+  return distribution;
+}
+
 void TimeInfo::getThreadStatistics(float& outAvgFreq, float& outMin, float& outMax) const
 {
   outAvgFreq = threadDeltas.sum() != 0.f ? 1000.0f / threadDeltas.average() : 0.f;
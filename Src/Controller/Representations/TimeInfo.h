@@ -12,6 +12,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 class InMessage;
 
@@ -37,9 +38,20 @@ public:
   using Info = InfoWithTimestamp;
   using Infos = std::unordered_map<unsigned short, Info>;
 
+  /** The distribution of all measurements of a stop watch recorded. */
+  struct Distribution
+  {
+    size_t count = 0; /**< The number of measurements. */
+    float median = 0.f; /**< The median in ms. */
+    float percentile95 = 0.f; /**< The 95th percentile in ms. */
+    float maximum = 0.f; /**< The longest measurement in ms. */
+  };
+
   std::string threadName;
   Infos infos;
   unsigned int timestamp; /**< The timestamp of the last change. */
+  bool recording = false; /**< Record all measurements in addition to the last 100 ones in infos? */
+  std::unordered_map<unsigned short, std::vector<unsigned>> recorded; /**< All measurements recorded per stop watch in µs. */
 
 private:
   std::unordered_map<unsigned short, std::string> names;
@@ -72,6 +84,13 @@ public:
    */
   void getStatistics(const Info& info, float& outMinTime, float& outMaxTime, float& outAvgTime) const;
 
+  /**
+   * The function returns the distribution of all measurements of a stop watch recorded.
+   * @param watchId The id of the stop watch.
+   * @return The distribution. Its count is 0 if nothing was recorded.
+   */
+  Distribution getDistribution(unsigned short watchId) const;
+
   /**
    * Returns the frequency of the process attached to this time info.
    */
@@ -221,6 +221,15 @@ void RoboCupCtrl::update()
   gameController.referee();
 
   statusText = "";
+
+  // The robots convert and send the data of the previous step concurrently, while the
+  // simulation is stepped. All of them are joined before the simulation is accessed
+  // again, which is only done from this thread. Only the camera images are rendered
+  // before, because their readback can proceed while waiting for the robots.
+  for(Robot* robot : robots)
+    robot->startRendering();
+  for(Robot* robot : robots)
+    robot->join();
   for(Robot* robot : robots)
     robot->update();
   if(simTime)
@@ -30,6 +30,7 @@ public:
   GameController gameController;
   Settings::TeamColor firstTeamColor = static_cast<Settings::TeamColor>(-1); /**< Color of the first team. */
   Settings::TeamColor secondTeamColor = static_cast<Settings::TeamColor>(-1); /**< Color of the second team. */
+  int teamPortOffset = 0; /**< Added to the team communication ports, so that several simulations can run on the same computer. */
 
 protected:
   const char* robotName = nullptr; /**< The name of the robot currently constructed. */
@@ -8,6 +8,7 @@
 
 #include "RobotConsole.h"
 
+#include <QDirIterator>
 #include <algorithm>
 #include <fstream>
 #include <iostream>
@@ -232,58 +233,15 @@ bool RobotConsole::handleMessage(InMessage& message)
       commands.push_back(message.text.readAll());
       return true;
     case idCameraImage:
-    {
-      CameraImage ci;
-      message.bin >> ci;
-      if(incompleteImages["raw image"].image)
-        incompleteImages["raw image"].image->from(ci);
-      else
-        incompleteImages["raw image"].image = new DebugImage(ci, true);
-      return true;
-    }
     case idJPEGImage:
-    {
-      CameraImage ci;
-      JPEGImage jpi;
-      message.bin >> jpi;
-      jpi.toCameraImage(ci);
-      if(incompleteImages["raw image"].image)
-        incompleteImages["raw image"].image->from(ci);
-      else
-        incompleteImages["raw image"].image = new DebugImage(ci, true);
-      return true;
-    }
     case idThumbnail:
-    {
-      Thumbnail thumbnail;
-      message.bin >> thumbnail;
-      if(thumbnail.mode != Thumbnail::yuv)
-      {
-        if(incompleteImages["raw image"].image)
-          incompleteImages["raw image"].image->from(thumbnail.imageY);
-        else
-          incompleteImages["raw image"].image = new DebugImage(thumbnail.imageY, true);
-      }
-      else
-      {
-        Image<PixelTypes::YUYVPixel> i;
-        thumbnail.toYUYV(i);
-        if(incompleteImages["raw image"].image)
-          incompleteImages["raw image"].image->from(i);
-        else
-          incompleteImages["raw image"].image = new DebugImage(i, true);
-      }
-      incompleteImages["raw image"].image->timestamp = Time::getCurrentSystemTime();
+      decodeLater(message, "raw image");
       return true;
-    }
     case idDebugImage:
     {
       std::string id;
       message.bin >> id;
-      if(!incompleteImages[id].image)
-        incompleteImages[id].image = new DebugImage();
-      message.bin >> *incompleteImages[id].image;
-      incompleteImages[id].image->timestamp = Time::getCurrentSystemTime();
+      decodeLater(message, id);
       break;
     }
     case idFsrSensorData:
@@ -343,6 +301,24 @@ bool RobotConsole::handleMessage(InMessage& message)
       }
       return true;
     }
+    case idDebugDrawingPacked:
+    {
+      if(polled[idDrawingManager] && !waitingFor[idDrawingManager]) // drawing manager not up-to-date
+      {
+        ThreadData& data = threadData[threadIdentifier];
+        char id;
+        PackedDrawing packedDrawing;
+        message.bin >> id >> packedDrawing;
+        const char* name = data.drawingManager.getDrawingName(id); // const char* is required here
+        std::string type = data.drawingManager.getDrawingType(name);
+
+        if(type == "drawingOnImage")
+          incompleteImageDrawings[name].addPackedDrawing(packedDrawing);
+        else if(type == "drawingOnField")
+          incompleteFieldDrawings[name].addPackedDrawing(packedDrawing);
+      }
+      return true;
+    }
     case idDebugDrawing3D:
     {
       if(polled[idDrawingManager3D] && !waitingFor[idDrawingManager3D])
@@ -360,9 +336,8 @@ bool RobotConsole::handleMessage(InMessage& message)
       float value;
       message.bin >> id >> value;
       Plot& plot = plots[ctrl->translate(id)];
-      plot.points.push_back(value);
-      while(plot.points.size() > maxPlotSize)
-        plot.points.pop_front();
+      plot.points.setCapacity(maxPlotSize);
+      plot.points.push_front(value);
       plot.timestamp = Time::getCurrentSystemTime();
       return true;
     }
@@ -378,14 +353,12 @@ bool RobotConsole::handleMessage(InMessage& message)
 
       ThreadData& data = threadData[threadIdentifier];
 
-      data.images.clear();
-      for(auto& pair : incompleteImages)
-      {
-        ImagePtr& imagePtr = data.images[pair.first];
-        imagePtr.image = pair.second.image;
-        imagePtr.threadIdentifier = threadIdentifier;
-        pair.second.image = nullptr;
-      }
+      // Images not sent in this frame are removed. The others are replaced when they are decoded.
+      for(auto i = data.images.begin(); i != data.images.end();)
+        if(imagesOfFrame.find(i->first) == imagesOfFrame.end())
+          i = data.images.erase(i);
+        else
+          ++i;
 
       // Remove drawings generated by this thread from this thread
       for(auto i = data.imageDrawings.begin(); i != data.imageDrawings.end();)
@@ -454,7 +427,7 @@ bool RobotConsole::handleMessage(InMessage& message)
         }
       }
 
-      incompleteImages.clear();
+      imagesOfFrame.clear();
       incompleteImageDrawings.clear();
       incompleteFieldDrawings.clear();
       incompleteDrawings3D.clear();
@@ -608,6 +581,107 @@ bool RobotConsole::handleMessage(InMessage& message)
   return false;
 }
 
+void RobotConsole::decodeLater(InMessage& message, const std::string& name)
+{
+  imagesOfFrame.insert(name);
+  PendingImage& pendingImage = threadData[threadIdentifier].pendingImages[name];
+  pendingImage.id = message.getMessageID();
+  pendingImage.data.resize(message.getMessageSize());
+  message.resetReadPosition();
+  message.bin.read(pendingImage.data.data(), pendingImage.data.size());
+  if(pendingImage.decoding)
+    return;
+
+  pendingImage.decoding = true;
+  decoders.add([this, threadName = threadIdentifier, name]
+  {
+    std::vector<char> data;
+    for(;;)
+    {
+      MessageID id;
+      {
+        SYNC;
+        PendingImage& pendingImage = threadData[threadName].pendingImages[name];
+        if(destructed || pendingImage.data.empty())
+        {
+          pendingImage.decoding = false;
+          return;
+        }
+        id = pendingImage.id;
+        data.swap(pendingImage.data);
+      }
+
+      DebugImage* image = decodeImage(id, data);
+
+      SYNC;
+      if(destructed)
+        delete image;
+      else
+      {
+        ImagePtr& imagePtr = threadData[threadName].images[name];
+        imagePtr.reset();
+        imagePtr.image = image;
+        imagePtr.threadIdentifier = threadName;
+      }
+
+      // Return the buffer so that the next message can reuse its memory.
+      PendingImage& pendingImage = threadData[threadName].pendingImages[name];
+      if(pendingImage.data.empty())
+      {
+        data.clear();
+        pendingImage.data.swap(data);
+      }
+    }
+  });
+}
+
+DebugImage* RobotConsole::decodeImage(MessageID id, const std::vector<char>& data)
+{
+  InBinaryMemory stream(data.data(), data.size());
+  switch(id)
+  {
+    case idCameraImage:
+    {
+      CameraImage ci;
+      stream >> ci;
+      return new DebugImage(ci, true);
+    }
+    case idJPEGImage:
+    {
+      CameraImage ci;
+      JPEGImage jpi;
+      stream >> jpi;
+      jpi.toCameraImage(ci);
+      return new DebugImage(ci, true);
+    }
+    case idThumbnail:
+    {
+      Thumbnail thumbnail;
+      stream >> thumbnail;
+      DebugImage* image;
+      if(thumbnail.mode != Thumbnail::yuv)
+        image = new DebugImage(thumbnail.imageY, true);
+      else
+      {
+        Image<PixelTypes::YUYVPixel> i;
+        thumbnail.toYUYV(i);
+        image = new DebugImage(i, true);
+      }
+      image->timestamp = Time::getCurrentSystemTime();
+      return image;
+    }
+    default:
+    {
+      ASSERT(id == idDebugImage);
+      std::string name;
+      DebugImage* image = new DebugImage();
+      stream >> name >> *image;
+      image->timestamp = Time::getCurrentSystemTime();
+      return image;
+    }
+  }
+}
+
 void RobotConsole::update()
 {
   setGlobals(); // this is called in GUI thread -> set globals for this thread
@@ -838,6 +912,8 @@ bool RobotConsole::handleConsoleLine(const std::string& line)
   }
   else if(command == "bc")
     result = backgroundColor(stream);
+  else if(command == "bm")
+    result = benchmark(stream);
   else if(command == "kick")
   {
     result = kickView();
@@ -1076,6 +1152,126 @@ bool RobotConsole::backgroundColor(In& stream)
   return true;
 }
 
+bool RobotConsole::benchmark(In& stream)
+{
+  std::string command;
+  stream >> command;
+  if(command == "start" || command == "stop")
+  {
+    SYNC;
+    for(auto& pair : threadData)
+    {
+      if(command == "start")
+        pair.second.timeInfo.recorded.clear();
+      pair.second.timeInfo.recording = command == "start";
+    }
+    return true;
+  }
+  else if(command == "save")
+  {
+    std::string name;
+    stream >> name;
+    if(name.empty())
+    {
+      std::string::size_type pos = logPlayer.logfilePath.rfind(".");
+      if(pos == std::string::npos)
+        return false;
+      name = logPlayer.logfilePath.substr(0, pos) + "_Benchmark";
+    }
+    if(static_cast<int>(name.rfind('.')) <= static_cast<int>(name.find_last_of("\\/")))
+      name = name + ".csv";
+
+    std::ofstream file(name);
+    if(!file.is_open())
+      return false;
+    file << "thread,stopwatch,count,median,95%,max\n";
+    SYNC;
+    for(const auto& pair : threadData)
+    {
+      const TimeInfo& timeInfo = pair.second.timeInfo;
+      for(const auto& watch : timeInfo.recorded)
+      {
+        const TimeInfo::Distribution distribution = timeInfo.getDistribution(watch.first);
+        file << pair.first << "," << timeInfo.getName(watch.first) << "," << distribution.count << ","
+             << distribution.median << "," << distribution.percentile95 << "," << distribution.maximum << "\n";
+      }
+    }
+    ctrl->printLn("Saved benchmark to " + name);
+    return true;
+  }
+  else if(command == "compare")
+  {
+    std::string name;
+    float tolerance = 10.f;
+    stream >> name >> tolerance;
+    if(name.empty())
+      return false;
+    if(static_cast<int>(name.rfind('.')) <= static_cast<int>(name.find_last_of("\\/")))
+      name = name + ".csv";
+
+    // Read the baseline, skipping the header line.
+    std::ifstream file(name);
+    if(!file.is_open())
+    {
+      ctrl->printLn("Error: RobotConsole: Cannot read the baseline " + name + ".");
+      RoboCupCtrl::application->setFailed();
+      return true;
+    }
+    std::unordered_map<std::string, float> baseline;
+    std::string line;
+    std::getline(file, line);
+    while(std::getline(file, line))
+    {
+      std::vector<std::string> columns;
+      for(std::string::size_type start = 0, end = 0; end != std::string::npos; start = end + 1)
+      {
+        end = line.find(',', start);
+        columns.emplace_back(line.substr(start, end == std::string::npos ? std::string::npos : end - start));
+      }
+      if(columns.size() == 6)
+        baseline[columns[0] + "," + columns[1]] = static_cast<float>(std::atof(columns[4].c_str()));
+    }
+
+    // Compare the 95th percentiles, because single outliers are not significant.
+    int regressions = 0;
+    int compared = 0;
+    SYNC;
+    for(const auto& pair : threadData)
+    {
+      const TimeInfo& timeInfo = pair.second.timeInfo;
+      for(const auto& watch : timeInfo.recorded)
+      {
+        const std::string watchName = timeInfo.getName(watch.first);
+        const auto i = baseline.find(pair.first + "," + watchName);
+        if(i == baseline.end())
+          continue;
+        const float percentile95 = timeInfo.getDistribution(watch.first).percentile95;
+        const float change = i->second > 0.f ? (percentile95 / i->second - 1.f) * 100.f : 0.f;
+        const bool regression = change > tolerance;
+        ++compared;
+        regressions += regression ? 1 : 0;
+        char buffer[200];
+        snprintf(buffer, sizeof(buffer), "%s %s: %.3f ms -> %.3f ms (%+.1f%%)%s", pair.first.c_str(), watchName.c_str(),
+                i->second, percentile95, change, regression ? " regression" : "");
+        ctrl->printLn(buffer);
+      }
+    }
+    const std::string summary = std::to_string(regressions) + " of " + std::to_string(compared) + " stopwatches slower than "
+                                + std::to_string(static_cast<int>(tolerance)) + "% over baseline";
+
+    // A regression lets a batch run fail, so it is not overlooked in a script.
+    if(regressions)
+    {
+      ctrl->printLn("Error: RobotConsole: " + summary + ".");
+      RoboCupCtrl::application->setFailed();
+    }
+    else
+      ctrl->printLn(summary);
+    return true;
+  }
+  return false;
+}
+
 bool RobotConsole::debugRequest(In& stream)
 {
   std::string debugRequestString, state;
@@ -1167,6 +1363,53 @@ bool RobotConsole::log(In& stream)
     logPlayer.init();
     return true;
   }
+  else if(command == "batch")
+  {
+    SYNC;
+    std::string directory;
+    std::string extraction;
+    stream >> directory >> extraction;
+
+    // Only extractions are supported, because they name their results after each log file.
+    // A log that only exists in memory would be lost.
+    if(directory.empty() || extraction.size() <= 4 || extraction.compare(0, 4, "save")
+       || logPlayer.state == LogPlayer::recording || (logFile.empty() && logPlayer.getNumberOfMessages()))
+      return false;
+    while(!stream.eof())
+    {
+      std::string argument;
+      stream >> argument;
+      if(!argument.empty())
+        extraction += " " + argument;
+    }
+
+    if(!File::isAbsolute(directory.c_str()))
+      directory = std::string(File::getBHDir()) + "/Config/Logs/" + directory;
+    std::vector<std::string> fileNames;
+    for(QDirIterator i(directory.c_str(), QStringList("*.log"), QDir::Files, QDirIterator::Subdirectories); i.hasNext();)
+      fileNames.emplace_back(i.next().toUtf8().constData());
+    std::sort(fileNames.begin(), fileNames.end());
+
+    bool success = !fileNames.empty();
+    for(const std::string& fileName : fileNames)
+    {
+      ctrl->printLn(fileName);
+      if(logPlayer.open(fileName))
+      {
+        InTextMemory strMem(extraction.c_str(), extraction.size());
+        success &= log(strMem);
+      }
+      else
+        success = false;
+    }
+
+    // Restore the log that was replayed before.
+    if(logFile.empty())
+      logPlayer.init();
+    else
+      logPlayer.open(logFile);
+    return success;
+  }
   else if(command == "save")
   {
     std::string splitCommand;
@@ -1368,14 +1611,14 @@ bool RobotConsole::log(In& stream)
       stream >> buf;
       std::string state;
       stream >> state;
+      ActivationGraph activationGraph; // Names are only streamed once, so the graph must persist.
       logPlayer.keepFrames([&](InMessage& message) -> bool
       {
         if(message.getMessageID() == idActivationGraph)
         {
-          ActivationGraph activationGraph;
           message.bin >> activationGraph;
           for(const auto& node : activationGraph.graph)
-            if(node.option == buf && (state.empty() || node.state == state))
+            if(activationGraph.getName(node.option) == buf && (state.empty() || activationGraph.getName(node.state) == state))
               return true;
           return false;
         }
@@ -1619,6 +1862,16 @@ bool RobotConsole::log(In& stream)
       logPlayer.setLoop(false);
       return true;
     }
+    else if(command == "steps")
+    {
+      fastReplay = false;
+      return true;
+    }
+    else if(command == "fast")
+    {
+      fastReplay = true;
+      return true;
+    }
     else if(command == "pause")
     {
       logPlayer.pause();
@@ -3065,6 +3318,9 @@ bool RobotConsole::saveImage(In& stream)
       stream >> filename;
     }
 
+    // The latest image received might still be decoded. This needs the lock, so wait before acquiring it.
+    decoders.wait();
+
     SYNC;
     DebugImage* srcImage;
     if(threadData[camera].images.find("raw image") != threadData[camera].images.end())
@@ -34,6 +34,7 @@
 #include "Representations/MotionControl/MotionRequest.h"
 #include "Tools/Debugging/DebugDrawings3D.h"
 #include "Tools/Debugging/DebugImages.h"
+#include "Tools/Debugging/PlotBuffer.h"
 #include "Tools/Framework/ThreadFrame.h"
 
 #include "LogPlayer.h" // Must be included after ThreadFrame.h
@@ -45,9 +46,13 @@
 #include "Views/DataView/DataView.h"
 #include "Visualization/DebugDrawing.h"
 #include "Visualization/DebugDrawing3D.h"
+#include "Tools/Parallel.h"
 
 #include <QString>
+#include <limits>
 #include <list>
+#include <unordered_set>
+#include <vector>
 
 class ConsoleRoboCupCtrl;
 class ColorCalibrationView;
@@ -88,7 +93,7 @@ public:
 
   struct Plot
   {
-    std::list<float> points;
+    PlotBuffer points; /**< The values, the newest first. */
     unsigned timestamp = 0;
   };
 
@@ -97,10 +102,22 @@ public:
   using Drawings3D = std::unordered_map<std::string, DebugDrawing3D>;
   using Plots = std::unordered_map<std::string, Plot>;
 
+  /**
+   * An image message that still has to be decoded. Only the latest one is kept,
+   * i.e. images that arrive faster than they are decoded are dropped.
+   */
+  struct PendingImage
+  {
+    MessageID id = undefined; /**< The type of the message. */
+    std::vector<char> data; /**< The contents of the message. Empty if there is no new image. */
+    bool decoding = false; /**< Is a worker currently responsible for this image? */
+  };
+
   struct ThreadData
   {
     TimeInfo timeInfo; /**< Information collected by stopwatches. */
     Images images; /**< Debug images. */
+    std::unordered_map<std::string, PendingImage> pendingImages; /**< Images received but not decoded yet. */
     DrawingManager drawingManager; /**< Mappings from drawing ids to drawing names. */
     DrawingManager3D drawingManager3D; /**< Mappings from 3D drawing ids to drawing names. */
     Drawings imageDrawings; /**< Drawings on camera images. */
@@ -237,6 +254,7 @@ protected:
   Vector3f movePos = Vector3f::Zero(); /**< The position the robot is moved to. */
   Vector3f moveRot = Vector3f::Zero(); /**< The rotation the robot is moved to. */
   bool jointCalibrationChanged = false; /**< Was the joint calibration changed since setting it for the local robot? */
+  bool fastReplay = false; /**< Replay log frames as fast as the robot code processes them rather than one per simulation step. */
 
   // Representations received
   JointCalibration jointCalibration; /**< The new joint calibration angles received from the robot code. */
@@ -249,7 +267,7 @@ private:
   DebugRequestTable debugRequestTable;
   DebugDataInfos debugDataInfos; /** All debug data information. */
   std::unordered_map<std::string, std::string> threadsOfDebugData; /**< From which thread was certain debug data accepted? */
-  Images incompleteImages; /** Buffers images of this frame (created on demand). */
+  std::unordered_set<std::string> imagesOfFrame; /**< The names of the images received in this frame. */
   Drawings incompleteImageDrawings; /**< Buffers incomplete image drawings from the debug queue. */
   Drawings incompleteFieldDrawings; /**< Buffers incomplete field drawings from the debug queue. */
   Drawings3D incompleteDrawings3D; /**< Buffers incomplete 3d drawings from the debug queue. */
@@ -315,6 +333,12 @@ private:
   std::string joystickButtonReleaseCommand[Joystick::numOfButtons]; /**< Command for each button release. */
   bool joystickExecCommand(const std::string&); /**< Exec command and optionally output trace to console. */
 
+  /**
+   * Decodes images outside of the lock. Must be the last member, because it
+   * finishes its tasks when destroyed, which still access the members above.
+   */
+  Parallel::Workers decoders{2, std::numeric_limits<size_t>::max()};
+
 public:
   /**
    * The constructor.
@@ -415,6 +439,26 @@ protected:
   /** Retrieves all annotations from log player. */
   void updateAnnotationsFromLog();
 
+  /**
+   * Schedules an image message for decoding by a worker thread. The image
+   * replaces the one with the same name of the current thread when finished.
+   * If an older image of that name is still waiting, it is dropped.
+   * Therefore, the images in threadData can lag behind the other data of a frame.
+   * Views just show the new images a little later. Commands that use an image
+   * directly, e.g. "si", must call decoders.wait() first without holding the lock.
+   * @param message The message containing the image.
+   * @param name The name of the image.
+   */
+  void decodeLater(InMessage& message, const std::string& name);
+
+  /**
+   * Decodes an image message.
+   * @param id The type of the message.
+   * @param data The contents of the message.
+   * @return The new image.
+   */
+  static DebugImage* decodeImage(MessageID id, const std::vector<char>& data);
+
 private:
   /**
    * The function adds per-thread views.
@@ -479,6 +523,7 @@ private:
   //!@{
   bool msg(In&);
   bool backgroundColor(In& stream);
+  bool benchmark(In& stream);
   bool debugRequest(In&);
   bool joystickCommand(In& stream);
   bool joystickSpeeds(In& stream);
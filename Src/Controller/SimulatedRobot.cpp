@@ -337,37 +337,54 @@ template<bool srcAligned, bool destAligned, bool avx> void convertImage(const un
   }
 }
 
-void SimulatedRobot::getImage(CameraImage& cameraImage, CameraInfo& cameraInfo)
+void SimulatedRobot::startRendering()
 {
   ASSERT(robot);
 
   if(cameraSensor)
-  {
     reinterpret_cast<SimRobotCore2::SensorPort*>(cameraSensor)->renderCameraImages(activeCameras, activeCameraCount);
+}
 
-    ASSERT(!cameraImage.isReference());
+void SimulatedRobot::renderImage(std::vector<unsigned char>& renderedImage, CameraInfo& cameraInfo)
+{
+  ASSERT(robot);
+
+  renderedImage.clear();
+  if(cameraSensor)
+  {
+    startRendering();
 
     cameraInfo = cameraInfos[cameraSensor == upperCameraSensor ? CameraInfo::upper : CameraInfo::lower];
-    cameraImage.setResolution(cameraInfo.width / 2, cameraInfo.height);
 
     const unsigned char* const src = reinterpret_cast<SimRobotCore2::SensorPort*>(cameraSensor)->getValue().byteArray;
-    if(simdAligned<_supportsAVX2>(src))
-    {
-      if(simdAligned<_supportsAVX2>(cameraImage[0]))
-        convertImage<true, true, _supportsAVX2>(src, cameraImage);
-      else
-        convertImage<true, false, _supportsAVX2>(src, cameraImage);
-    }
-    else
-    {
-      if(simdAligned<_supportsAVX2>(cameraImage[0]))
-        convertImage<false, true, _supportsAVX2>(src, cameraImage);
-      else
-        convertImage<false, false, _supportsAVX2>(src, cameraImage);
-    }
+    renderedImage.assign(src, src + cameraInfo.width * cameraInfo.height * 3);
   }
+}
 
-  cameraImage.timestamp = Time::getCurrentSystemTime();
+void SimulatedRobot::convertImage(const std::vector<unsigned char>& renderedImage, const CameraInfo& cameraInfo, CameraImage& cameraImage)
+{
+  if(renderedImage.empty())
+    return;
+
+  ASSERT(!cameraImage.isReference());
+  ASSERT(renderedImage.size() == static_cast<size_t>(cameraInfo.width * cameraInfo.height * 3));
+  cameraImage.setResolution(cameraInfo.width / 2, cameraInfo.height);
+
+  const unsigned char* const src = renderedImage.data();
+  if(simdAligned<_supportsAVX2>(src))
+  {
+    if(simdAligned<_supportsAVX2>(cameraImage[0]))
+      ::convertImage<true, true, _supportsAVX2>(src, cameraImage);
+    else
+      ::convertImage<true, false, _supportsAVX2>(src, cameraImage);
+  }
+  else
+  {
+    if(simdAligned<_supportsAVX2>(cameraImage[0]))
+      ::convertImage<false, true, _supportsAVX2>(src, cameraImage);
+    else
+      ::convertImage<false, false, _supportsAVX2>(src, cameraImage);
+  }
 }
 
 void SimulatedRobot::getCameraInfo(CameraInfo& cameraInfo)
@@ -18,6 +18,7 @@
 #include "Tools/Math/Eigen.h"
 #include "Tools/Math/Pose3f.h"
 #include "Tools/Streams/EnumIndexedArray.h"
+#include <vector>
 
 struct CameraImage;
 struct FsrSensorData;
@@ -108,11 +109,28 @@ public:
   static void getAbsoluteBallPosition(Vector2f& ballPosition);
 
   /**
-   * Determines the camera image of the simulated robot.
-   * @param cameraImage The determined image.
+   * Starts rendering the images of the active cameras of all robots in a single pass,
+   * unless this was already done in the current simulation step. They are read back
+   * asynchronously, i.e. other data can be exchanged before calling renderImage.
+   */
+  void startRendering();
+
+  /**
+   * Renders the camera image of the simulated robot (if not already started) and copies
+   * it, because the simulation reuses its buffer. The copy is converted by convertImage.
+   * @param renderedImage The rendered RGB image. It remains empty if the robot has no camera.
    * @param cameraInfo The information about the camera that took the image.
    */
-  void getImage(CameraImage& cameraImage, CameraInfo& cameraInfo);
+  void renderImage(std::vector<unsigned char>& renderedImage, CameraInfo& cameraInfo);
+
+  /**
+   * Converts a rendered RGB image into a camera image. As the simulation is not
+   * accessed, this can be done in another thread than the one rendering the image.
+   * @param renderedImage The image rendered by renderImage. Nothing happens if it is empty.
+   * @param cameraInfo The information about the camera that took the image.
+   * @param cameraImage The determined image.
+   */
+  static void convertImage(const std::vector<unsigned char>& renderedImage, const CameraInfo& cameraInfo, CameraImage& cameraImage);
 
   /**
    * Determines the camera information (in case no images are generated) of the simulated robot.
@@ -81,16 +81,17 @@ public:
         paintRectField0.setLeft(defaultLeft + 10 * activeOption.depth);
 
         sprintf(formattedTime, "%.02f", float(activeOption.optionTime) / 1000.f);
-        print(activeOption.option.c_str(), formattedTime, true, true);
+        print(info.getName(activeOption.option).c_str(), formattedTime, true, true);
 
         paintRectField0.setLeft(defaultLeft + 10 * activeOption.depth + 5);
         for(const std::string& parameter : activeOption.parameters)
           print(parameter.c_str(), "", false, false);
 
-        if(!activeOption.state.empty())
+        const std::string& state = info.getName(activeOption.state);
+        if(!state.empty())
         {
           sprintf(formattedTime, "%.02f", float(activeOption.stateTime) / 1000.f);
-          print(("state = " + activeOption.state).c_str(), formattedTime, false, true);
+          print(("state = " + state).c_str(), formattedTime, false, true);
         }
         newBlock();
       }
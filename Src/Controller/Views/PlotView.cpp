@@ -243,23 +243,39 @@ void PlotWidget::paint(QPainter& painter)
       painter.setRenderHints(QPainter::Antialiasing | QPainter::HighQualityAntialiasing);
     int legendWidth = 0;
     const std::list<RobotConsole::Layer>& plotList = plotView.console.plotViews[plotView.name];
+    const size_t columns = static_cast<size_t>(plotRect.width());
     for(const RobotConsole::Layer& layer : plotList)
     {
-      const std::list<float>& list = plotView.console.plots[layer.layer].points;
-      size_t numOfPoints = std::min(list.size(), static_cast<size_t>(plotView.plotSize));
+      const PlotBuffer& buffer = plotView.console.plots[layer.layer].points;
+      const size_t numOfPoints = std::min(buffer.size(), static_cast<size_t>(plotView.plotSize));
       if(numOfPoints > 1)
       {
-        std::list<float>::const_iterator k = list.end();
-        for(size_t i = 0; i < numOfPoints; ++i)
+        std::vector<QPointF>& points = plotView.points;
+        points.clear();
+        if(numOfPoints <= 2 * columns)
+          for(size_t i = 0; i < numOfPoints; ++i)
+            points.emplace_back(static_cast<qreal>(i), buffer[i]);
+        else
         {
-          plotView.points[i].ry() = *(--k);
+          // Long plots are drawn as the extremes of each pixel column, i.e. independent of their length.
+          for(size_t column = 0; column < columns; ++column)
+          {
+            const size_t begin = column * plotView.plotSize / columns;
+            const size_t end = std::min((column + 1) * plotView.plotSize / columns, numOfPoints);
+            if(begin >= end)
+              break;
+            const PlotBuffer::MinMax minMax = buffer.getMinMax(begin, end);
+            const bool maxFirst = !points.empty() && points.back().y() > (minMax.min + minMax.max) / 2.f;
+            points.emplace_back(static_cast<qreal>(begin), maxFirst ? minMax.max : minMax.min);
+            points.emplace_back(static_cast<qreal>(begin), maxFirst ? minMax.min : minMax.max);
+          }
         }
 
         const ColorRGBA& color = layer.color;
         QPen pen(QColor(color.r, color.g, color.b));
         pen.setWidth(0);
         painter.setPen(pen);
-        painter.drawPolyline(plotView.points, static_cast<int>(numOfPoints));
+        painter.drawPolyline(points.data(), static_cast<int>(points.size()));
       }
       unsigned int timestamp = plotView.console.plots[layer.layer].timestamp;
       if(timestamp > lastTimestamp)
@@ -315,27 +331,21 @@ void PlotWidget::determineMinMaxValue()
     const std::list<RobotConsole::Layer>& plotList = plotView.console.plotViews[plotView.name];
     for(const auto& layer : plotList)
     {
-      const std::list<float>& list = plotView.console.plots[layer.layer].points;
-      int numOfPoints = std::min(static_cast<int>(list.size()), static_cast<int>(plotView.plotSize));
+      const PlotBuffer& buffer = plotView.console.plots[layer.layer].points;
+      const size_t numOfPoints = std::min(buffer.size(), static_cast<size_t>(plotView.plotSize));
       if(numOfPoints > 1)
       {
-        std::list<float>::const_iterator k = list.begin();
-        for(int j = plotView.plotSize - numOfPoints; j < static_cast<int>(plotView.plotSize); ++j)
+        const PlotBuffer::MinMax minMax = buffer.getMinMax(0, numOfPoints);
+        if(started)
         {
-          const float& value(*(k++));
-          if(started)
-          {
-            if(value < plotView.minValue)
-              plotView.minValue = value;
-            else if(value > plotView.maxValue)
-              plotView.maxValue = value;
-          }
-          else
-          {
-            plotView.minValue = value;
-            plotView.maxValue = plotView.minValue + 0.00001f;
-            started = true;
-          }
+          plotView.minValue = std::min(plotView.minValue, minMax.min);
+          plotView.maxValue = std::max(plotView.maxValue, minMax.max);
+        }
+        else
+        {
+          plotView.minValue = minMax.min;
+          plotView.maxValue = std::max(minMax.max, plotView.minValue + 0.00001f);
+          started = true;
         }
       }
     }
@@ -391,8 +401,8 @@ void PlotWidget::exportAsGnuplot()
     numOfPlots = static_cast<int>(plotList.size());
     for(const RobotConsole::Layer& layer : plotList)
     {
-      const std::list<float>& list = plotView.console.plots[layer.layer].points;
-      int curNumOfPoints = std::min(static_cast<int>(list.size()), static_cast<int>(plotView.plotSize));
+      const PlotBuffer& buffer = plotView.console.plots[layer.layer].points;
+      int curNumOfPoints = std::min(static_cast<int>(buffer.size()), static_cast<int>(plotView.plotSize));
       if(curNumOfPoints < numOfPoints)
         numOfPoints = curNumOfPoints;
     }
@@ -408,10 +418,9 @@ void PlotWidget::exportAsGnuplot()
     int currentPlot = 0;
     for(const RobotConsole::Layer& layer : plotList)
     {
-      const std::list<float>& list = plotView.console.plots[layer.layer].points;
-      std::list<float>::const_reverse_iterator k = list.rbegin();
-      for(int j = numOfPoints - 1; j >= 0; --j)
-        data[j][currentPlot] = *(k++);
+      const PlotBuffer& buffer = plotView.console.plots[layer.layer].points;
+      for(int j = 0; j < numOfPoints; ++j)
+        data[j][currentPlot] = buffer[numOfPoints - 1 - j];
       ++currentPlot;
     }
   }
@@ -508,24 +517,10 @@ PlotView::PlotView(const QString& fullName, RobotConsole& console, const std::st
   fullName(fullName), icon(":/Icons/tag_green.png"), console(console), name(name), plotSize(plotSize),
   minValue(minValue), maxValue(maxValue), valueLength(maxValue - minValue),
   yUnit(yUnit), xUnit(xUnit), xScale(xScale)
-{
-  points = new QPointF[plotSize];
-  for(unsigned int i = 0; i < plotSize; ++i)
-    points[i].rx() = i;
-}
-
-PlotView::~PlotView()
-{
-  delete[] points;
-}
+{}
 
 void PlotView::setParameters(unsigned int plotSize, float minValue, float maxValue, const std::string& yUnit, const std::string& xUnit, float xScale)
 {
-  delete[] points;
-  points = new QPointF[plotSize];
-  for(unsigned int i = 0; i < plotSize; ++i)
-    points[i].rx() = i;
-
   this->plotSize = plotSize;
   this->minValue = minValue;
   this->maxValue = maxValue;
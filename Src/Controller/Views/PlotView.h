@@ -13,6 +13,7 @@
 #include <QPainter>
 #include <QIcon>
 #include <string>
+#include <vector>
 #include <SimRobot.h>
 
 class RobotConsole;
@@ -42,8 +43,6 @@ public:
            unsigned int plotSize, float minValue, float maxValue,
            const std::string& yUnit = "", const std::string& xUnit = "", float xScale = 1);
 
-  ~PlotView();
-
   /**
    * Changes the parameters of the plot.
    * @param plotSize The number of entries in a plot.
@@ -69,7 +68,7 @@ private:
   std::string yUnit; /**< The name of the y-axis. */
   std::string xUnit; /**< The name of the x-axis. */
   float xScale; /**< A scale factor for the x-axis. */
-  QPointF* points; /**< A buffer for drawing points. */
+  std::vector<QPointF> points; /**< A buffer for drawing points. */
 
   /**
    * The method returns a new instance of a widget for this direct view.
@@ -8,6 +8,7 @@
 
 #include <cstring>
 #include <limits>
+#include <vector>
 
 #include "DebugDrawing.h"
 #include "Platform/BHAssert.h"
@@ -292,6 +293,17 @@ void DebugDrawing::robot(Pose2f p, Vector2f dirVec, Vector2f dirHeadVec, float a
   write(&element, sizeof(element));
 }
 
+void DebugDrawing::addPackedDrawing(const PackedDrawing& packedDrawing)
+{
+  std::vector<PackedDrawing::Element> elements;
+  packedDrawing.getElements(elements);
+  for(const PackedDrawing::Element& element : elements)
+    if(element.shape == PackedDrawing::Shape::line)
+      this->line(element.x1, element.y1, element.x2, element.y2, static_cast<Drawings::PenStyle>(element.penStyle), element.width, element.penColor);
+    else
+      this->dot(static_cast<int>(element.x1), static_cast<int>(element.y1), element.penColor, element.brushColor);
+}
+
 bool DebugDrawing::addShapeFromQueue(InMessage& message, Drawings::ShapeType shapeType)
 {
   switch(static_cast<Drawings::ShapeType>(shapeType))
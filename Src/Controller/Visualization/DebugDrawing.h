@@ -280,6 +280,13 @@ public:
   void robot(Pose2f p, Vector2f dirVec, Vector2f dirHeadVec, float alphaRobot, ColorRGBA colorBody, ColorRGBA colorDirVec, ColorRGBA colorDirHeadVec);
 
   bool addShapeFromQueue(InMessage& message, Drawings::ShapeType shapeType);
+
+  /**
+   * Adds the lines and dots of a packed drawing.
+   * @param packedDrawing The packed drawing received from a thread.
+   */
+  void addPackedDrawing(const PackedDrawing& packedDrawing);
+
   /**
    * The function returns a pointer to the first drawing element.
    * @return A pointer to the first drawing element or 0 if the drawing is empty.
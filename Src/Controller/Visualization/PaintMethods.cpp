@@ -10,16 +10,35 @@
 #include <QPainterPath>
 #include "PaintMethods.h"
 #include "Platform/File.h"
+#include <algorithm>
 
 QBrush PaintMethods::brush(Qt::SolidPattern);
 QBrush PaintMethods::noBrush(Qt::NoBrush);
 QPen PaintMethods::pen;
 QPen PaintMethods::noPen(Qt::NoPen);
 QImage PaintMethods::robot = QImage((std::string(File::getBHDir()) + "/Src/Controller/Icons/robot.png").c_str());
+std::vector<QLineF> PaintMethods::lines;
+std::vector<QPointF> PaintMethods::points;
+std::vector<QRectF> PaintMethods::rects;
 
 void PaintMethods::paintDebugDrawing(QPainter& painter, const DebugDrawing& debugDrawing, const QTransform& baseTrans)
 {
-  for(const DebugDrawing::Element* e = debugDrawing.getFirst(); e; e = debugDrawing.getNext(e))
+  // Lines and dots are painted in batches, because drawings often consist of many of them.
+  // Only consecutive elements are combined, so the order in which elements overlap is kept.
+  QRectF rect;
+  for(const DebugDrawing::Element* e = debugDrawing.getFirst(); e;)
+  {
+    if(e->type == DebugDrawing::ElementType::line)
+    {
+      e = paintLines(*static_cast<const DebugDrawing::Line*>(e), debugDrawing, painter);
+      continue;
+    }
+    else if(e->type == DebugDrawing::ElementType::polygon && getRect(*static_cast<const DebugDrawing::Polygon*>(e), rect))
+    {
+      e = paintRects(*static_cast<const DebugDrawing::Polygon*>(e), debugDrawing, painter);
+      continue;
+    }
+
     switch(e->type)
     {
       case DebugDrawing::ElementType::polygon:
@@ -34,9 +53,6 @@ void PaintMethods::paintDebugDrawing(QPainter& painter, const DebugDrawing& debu
       case DebugDrawing::ElementType::rectangle:
         paintRectangle(*static_cast<const DebugDrawing::Rectangle*>(e), painter);
         break;
-      case DebugDrawing::ElementType::line:
-        paintLine(*static_cast<const DebugDrawing::Line*>(e), painter);
-        break;
       case DebugDrawing::ElementType::origin:
         paintOrigin(*static_cast<const DebugDrawing::Origin*>(e), painter, baseTrans);
         break;
@@ -49,18 +65,65 @@ void PaintMethods::paintDebugDrawing(QPainter& painter, const DebugDrawing& debu
       default:
         break;
     }
+    e = debugDrawing.getNext(e);
+  }
 }
 
-void PaintMethods::paintLine(const DebugDrawing::Line& element, QPainter& painter)
+const DebugDrawing::Element* PaintMethods::paintLines(const DebugDrawing::Line& element, const DebugDrawing& debugDrawing, QPainter& painter)
 {
+  lines.clear();
+  points.clear();
+  const DebugDrawing::Element* e = &element;
+  for(; e && e->type == DebugDrawing::ElementType::line && samePen(*e, element); e = debugDrawing.getNext(e))
+  {
+    const DebugDrawing::Line& line = *static_cast<const DebugDrawing::Line*>(e);
+    if(line.start == line.end)
+      points.emplace_back(line.start.x() + 0.5f, line.start.y() + 0.5f);
+    else
+      lines.emplace_back(line.start.x() + 0.5f, line.start.y() + 0.5f, line.end.x() + 0.5f, line.end.y() + 0.5f);
+  }
+
   if(element.penStyle != Drawings::noPen)
   {
     setPen(element, painter);
-    if(element.start == element.end)
-      painter.drawPoint(QPointF(element.start.x() + 0.5f, element.start.y() + 0.5f));
-    else
-      painter.drawLine(QLineF(element.start.x() + 0.5f, element.start.y() + 0.5f, element.end.x() + 0.5f, element.end.y() + 0.5f));
+    if(!lines.empty())
+      painter.drawLines(lines.data(), static_cast<int>(lines.size()));
+    if(!points.empty())
+      painter.drawPoints(points.data(), static_cast<int>(points.size()));
+  }
+  return e;
+}
+
+const DebugDrawing::Element* PaintMethods::paintRects(const DebugDrawing::Polygon& element, const DebugDrawing& debugDrawing, QPainter& painter)
+{
+  rects.clear();
+  QRectF rect;
+  const DebugDrawing::Element* e = &element;
+  for(; e && e->type == DebugDrawing::ElementType::polygon; e = debugDrawing.getNext(e))
+  {
+    const DebugDrawing::Polygon& polygon = *static_cast<const DebugDrawing::Polygon*>(e);
+    if(!samePen(polygon, element) || polygon.brushStyle != element.brushStyle
+       || (element.brushStyle != Drawings::noBrush && polygon.brushColor != element.brushColor)
+       || !getRect(polygon, rect))
+      break;
+    rects.emplace_back(rect);
   }
+
+  setBrush(element.brushStyle, element.brushColor, painter);
+  setPen(element, painter);
+  painter.drawRects(rects.data(), static_cast<int>(rects.size()));
+  return e;
+}
+
+bool PaintMethods::getRect(const DebugDrawing::Polygon& element, QRectF& rect)
+{
+  if(element.nCount != 4)
+    return false;
+  const int* p = reinterpret_cast<const int*>(&element + 1);
+  if(p[1] != p[3] || p[2] != p[4] || p[5] != p[7] || p[6] != p[0])
+    return false;
+  rect = QRectF(QPointF(std::min(p[0], p[2]), std::min(p[1], p[5])), QPointF(std::max(p[0], p[2]), std::max(p[1], p[5])));
+  return true;
 }
 
 void PaintMethods::paintPolygon(const DebugDrawing::Polygon& element, QPainter& painter)
@@ -9,6 +9,10 @@
 #pragma once
 
 #include "DebugDrawing.h"
+#include <QLineF>
+#include <QPointF>
+#include <QRectF>
+#include <vector>
 
 class DebugDrawing;
 class QPainter;
@@ -28,6 +32,9 @@ private:
   static QPen pen;
   static QPen noPen;
   static QImage robot;
+  static std::vector<QLineF> lines; /**< A buffer for drawing lines in a batch. */
+  static std::vector<QPointF> points; /**< A buffer for drawing points in a batch. */
+  static std::vector<QRectF> rects; /**< A buffer for drawing rectangles in a batch. */
 
 public:
   /**
@@ -38,7 +45,25 @@ public:
    */
   static void paintDebugDrawing(QPainter& painter, const DebugDrawing& debugDrawing, const QTransform& baseTrans);
 
-  static void paintLine(const DebugDrawing::Line& element, QPainter& painter);
+  /**
+   * Paints a line and all lines directly following it that use the same pen with a single call.
+   * @param element The first line.
+   * @param debugDrawing The drawing the line is part of.
+   * @param painter The graphics context the lines are painted to.
+   * @return The first element not painted or nullptr if there is none.
+   */
+  static const DebugDrawing::Element* paintLines(const DebugDrawing::Line& element, const DebugDrawing& debugDrawing, QPainter& painter);
+
+  /**
+   * Paints an axis-aligned rectangle stored as polygon (e.g. a dot) and all such
+   * rectangles directly following it that use the same pen and brush with a single call.
+   * @param element The first rectangle.
+   * @param debugDrawing The drawing the rectangle is part of.
+   * @param painter The graphics context the rectangles are painted to.
+   * @return The first element not painted or nullptr if there is none.
+   */
+  static const DebugDrawing::Element* paintRects(const DebugDrawing::Polygon& element, const DebugDrawing& debugDrawing, QPainter& painter);
+
   static void paintPolygon(const DebugDrawing::Polygon& element, QPainter& painter);
   static void paintEllipse(const DebugDrawing::Ellipse& element, QPainter& painter);
   static void paintArc(const DebugDrawing::Arc& element, QPainter& painter);
@@ -49,4 +74,19 @@ public:
 
   static void setPen(const DebugDrawing::Element& element, QPainter& painter);
   static void setBrush(const Drawings::BrushStyle brushStyle, const ColorRGBA& brushColor, QPainter& painter);
+
+private:
+  /**
+   * Returns the corners of a polygon if it is an axis-aligned rectangle.
+   * @param element The polygon.
+   * @param rect The rectangle if the polygon is one.
+   * @return Is the polygon an axis-aligned rectangle?
+   */
+  static bool getRect(const DebugDrawing::Polygon& element, QRectF& rect);
+
+  /** Do two elements use the same pen? */
+  static bool samePen(const DebugDrawing::Element& a, const DebugDrawing::Element& b)
+  {
+    return a.penStyle == b.penStyle && a.width == b.width && a.penColor == b.penColor;
+  }
 };
@@ -36,8 +36,7 @@ std::vector<ModuleBase::Info> BehaviorControl::getExtModuleInfo()
 
 void BehaviorControl::update(ActivationGraph& activationGraph)
 {
-  activationGraph.graph.clear();
-  activationGraph.currentDepth = 0;
+  activationGraph.beginFrame();
 
   theBehaviorStatus.passTarget = -1;
   theBehaviorStatus.walkingTo = Vector2f::Zero();
@@ -53,9 +52,9 @@ void BehaviorControl::update(ActivationGraph& activationGraph)
   theCardRegistry.preProcess(theFrameInfo.time);
 
   ASSERT(activationGraph.graph.empty());
-  activationGraph.graph.emplace_back("BehaviorControl", 0, TypeRegistry::getEnumName(status), theFrameInfo.time, 0, std::vector<std::string>());
+  activationGraph.add("BehaviorControl", 0, TypeRegistry::getEnumName(status), theFrameInfo.time, 0);
   this->execute();
-  activationGraph.graph[0].state = TypeRegistry::getEnumName(status);
+  activationGraph.graph[0].state = activationGraph.getIndex(TypeRegistry::getEnumName(status));
 
   theCardRegistry.postProcess();
   theSkillRegistry.postProcess();
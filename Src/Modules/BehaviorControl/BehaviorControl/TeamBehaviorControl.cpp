@@ -29,8 +29,7 @@ std::vector<ModuleBase::Info> TeamBehaviorControl::getExtModuleInfo()
 
 void TeamBehaviorControl::update(TeamActivationGraph& teamActivationGraph)
 {
-  teamActivationGraph.graph.clear();
-  teamActivationGraph.currentDepth = 0;
+  teamActivationGraph.beginFrame();
 
   theTeamSkillRegistry.modifyAllParameters();
   theTeamCardRegistry.modifyAllParameters();
@@ -38,7 +37,7 @@ void TeamBehaviorControl::update(TeamActivationGraph& teamActivationGraph)
   theTeamSkillRegistry.preProcess(theFrameInfo.time);
   theTeamCardRegistry.preProcess(theFrameInfo.time);
 
-  teamActivationGraph.graph.emplace_back("TeamBehaviorControl", 0, "", theFrameInfo.time, 0, std::vector<std::string>());
+  teamActivationGraph.add("TeamBehaviorControl", 0, "", theFrameInfo.time, 0);
   CardBase* card = theTeamCardRegistry.getCard(rootCard);
   ASSERT(card);
   card->call();
@@ -119,6 +119,9 @@ std::string LibCheckProvider::getActivationGraphString(const ActivationGraph& ac
 {
   std::string options = "";
   for(const auto& node : activationGraph.graph)
-    options += (options == "" ? "" : ", ") + node.option + (node.state == "" ? "" : "/" + node.state);
+  {
+    const std::string& state = activationGraph.getName(node.state);
+    options += (options == "" ? "" : ", ") + activationGraph.getName(node.option) + (state == "" ? "" : "/" + state);
+  }
   return options;
 }
@@ -252,6 +252,7 @@ bool LogDataProvider::handleMessage2(InMessage& message)
 
     case idFrameFinished:
       frameDataComplete = true;
+      frameDataReceived = true;
       return true;
 
     case idStopwatch:
@@ -153,8 +153,9 @@ private:
 
   std::array<State, numOfDataMessageIDs> states; /**< Should the corresponding message ids be replayed? */
   TypeInfo* logTypeInfo = nullptr; /**< The specifications of all the types from the log file. */
-  const TypeInfo currentTypeInfo; /**< The specifications of the types in this executable. */
+  const TypeInfo& currentTypeInfo = TypeInfo::getCurrent(); /**< The specifications of the types in this executable. */
   bool frameDataComplete; /**< Were all messages of the current frame received? */
+  bool frameDataReceived = false; /**< Was any frame received from the log file so far? */
   Thumbnail* thumbnail; /**< This will be allocated when a thumbnail was received. */
   OdometryData lastOdometryData; /** The last odometry data that was provided. Used for computing offset. */
   std::unordered_set<std::string> providedRepresentations; /** The representations that should be provided by this module. */
@@ -259,6 +260,13 @@ public:
    */
   static bool isFrameDataComplete();
 
+  /**
+   * Were frames of this thread received from the log file so far? In that case,
+   * the frames of the log file determine when this thread executes its frames.
+   * @return Does this thread replay its own frames from a log file?
+   */
+  static bool isReplayingFrames() {return theInstance && theInstance->frameDataReceived;}
+
   /**
    * Does an instance of this module exist in this thread?
    */
@@ -15,6 +15,7 @@
 #include "Tools/Global.h"
 #include "Tools/Settings.h"
 #include "Tools/Streams/OutStreams.h"
+#include <algorithm>
 #include <cstring>
 #include <csignal>
 
@@ -213,16 +214,7 @@ NaoProvider::NaoProvider()
   ASSERT(!theInstance);
   theInstance = this;
 
-  // Set all pointers into receivedPacket to nullptr
-  std::memset(&fsrs[0][0], 0, sizeof(fsrs));
-  std::memset(&gyros[0], 0, sizeof(gyros));
-  std::memset(&accs[0], 0, sizeof(accs));
-  std::memset(&torsoAngles[0], 0, sizeof(torsoAngles));
-  std::memset(&jointAngles[0], 0, sizeof(jointAngles));
-  std::memset(&jointCurrents[0], 0, sizeof(jointCurrents));
-  std::memset(&jointTemperatures[0], 0, sizeof(jointTemperatures));
-  std::memset(&jointStatuses[0], 0, sizeof(jointStatuses));
-  std::memset(&keys[0], 0, sizeof(keys));
+  // Set all pointers into packetToSend to nullptr
   std::memset(&jointRequests[0], 0, sizeof(jointRequests));
   std::memset(&jointStiffnesses[0], 0, sizeof(jointStiffnesses));
   std::memset(&leds[0], 0, sizeof(leds));
@@ -335,98 +327,153 @@ void NaoProvider::receivePacket()
   {
     timeWhenPacketReceived = std::max(Time::getCurrentSystemTime(), timeWhenPacketReceived + 1);
 
-    // Initialize tables if they have not been so far
-    if(!batteryLevel)
+    // Initialize tables if they have not been so far or if LoLA changed the layout
+    if(!layoutPacketSize || !hasSameLayout(bytesRead))
     {
-      MsgPack::parse(receivedPacket, bytesRead,
-
-        // Most data is encoded as float 32
-        [this](const std::string& key, const unsigned char* p)
-        {
-          const std::string::size_type pos = key.find(":");
-          ASSERT(pos != std::string::npos);
-          const std::string category = key.substr(0, pos);
-          const int index = std::stoi(key.substr(pos + 1));
-
-          if(category == "Current")
-            jointCurrents[jointMappings[index]] = p;
-          else if(category == "Position")
-            jointAngles[jointMappings[index]] = p;
-          else if(category == "Temperature")
-            jointTemperatures[jointMappings[index]] = p;
-          else if(category == "FSR")
-            fsrs[index / FsrSensors::numOfFsrSensors][index % FsrSensors::numOfFsrSensors] = p;
-          else if(category == "Accelerometer")
-            accs[index] = p;
-          else if(category == "Gyroscope")
-            gyros[index] = p;
-          else if(category == "Angles")
-            torsoAngles[index] = p;
-          else if(category == "Touch")
-            keys[keyMappings[index]] = p;
-          else if(category == "Battery")
-          {
-            if(index == 0)
-              batteryLevel = p;
-            else if(index == 1)
-              batteryCharging = p;
-            else if(index == 2)
-              batteryCurrent = p;
-            else
-              batteryTemperature = p;
-          }
-          else if(category != "Sonar" && category != "Stiffness")
-            OUTPUT_WARNING("Unknown key " << key);
-        },
-
-        // Only joint temperature statuses are encoded as positive fixint
-        [this](const std::string& key, const unsigned char* p)
-        {
-          const std::string::size_type pos = key.find(":");
-          ASSERT(pos != std::string::npos);
-          const std::string category = key.substr(0, pos);
-          const int index = std::stoi(key.substr(pos + 1));
-
-          if(category == "Status")
-            jointStatuses[jointMappings[index]] = p;
-          else
-            OUTPUT_WARNING("Unknown key " << key);
-        },
-
-        // Ignore strings
-        [](const std::string& key, const unsigned char* p, size_t size) {});
-
-      // Initialize the packet to send to LoLA
-      // Please note that the code assumes that the order of sensors and actuators is the same
-      unsigned char* p = packetToSend;
-      MsgPack::writeMapHeader(10, p);
-
-      // Determine addresses for target positions
-      MsgPack::write("Position", p);
-      MsgPack::writeArrayHeader(Joints::numOfJoints - 1, p);
-      for(int i = 0; i < Joints::numOfJoints - 1; ++i)
-        jointRequests[jointMappings[i]] = MsgPack::write(0.f, p);
-
-      // Determine addresses for stiffnesses
-      MsgPack::write("Stiffness", p);
-      MsgPack::writeArrayHeader(Joints::numOfJoints - 1, p);
-      for(int i = 0; i < Joints::numOfJoints - 1; ++i)
-        jointStiffnesses[jointMappings[i]] = MsgPack::write(0.f, p);
-
-      // Determine addresses for leds
-      writeLEDs("REar", rightEarMappings, LEDRequest::chestRed - LEDRequest::earsRight0Deg, p);
-      writeLEDs("LEar", leftEarMappings, LEDRequest::earsRight0Deg - LEDRequest::earsLeft0Deg, p);
-      writeLEDs("Chest", chestMappings, LEDRequest::headRearLeft0 - LEDRequest::chestRed, p);
-      writeLEDs("LEye", leftEyeMappings, LEDRequest::faceRightRed0Deg - LEDRequest::faceLeftRed0Deg, p);
-      writeLEDs("REye", rightEyeMappings, LEDRequest::earsLeft0Deg - LEDRequest::faceRightRed0Deg, p);
-      writeLEDs("LFoot", leftFootMappings, LEDRequest::footRightRed - LEDRequest::footLeftRed, p);
-      writeLEDs("RFoot", rightFootMappings, LEDRequest::numOfLEDs - LEDRequest::footRightRed, p);
-      writeLEDs("Skull", skullMappings, LEDRequest::footLeftRed - LEDRequest::headRearLeft0, p);
-
-      packetToSendSize = static_cast<int>(p - packetToSend);
-      ASSERT(packetToSendSize <= static_cast<int>(sizeof(packetToSend)));
+      if(layoutPacketSize)
+        OUTPUT_WARNING("The layout of LoLA's packets has changed");
+      parseLayout(bytesRead);
     }
+    if(!packetToSendSize)
+      initPacketToSend();
+  }
+}
+
+void NaoProvider::parseLayout(size_t size)
+{
+  // Set all pointers into receivedPacket to nullptr
+  std::memset(&fsrs[0][0], 0, sizeof(fsrs));
+  std::memset(&gyros[0], 0, sizeof(gyros));
+  std::memset(&accs[0], 0, sizeof(accs));
+  std::memset(&torsoAngles[0], 0, sizeof(torsoAngles));
+  std::memset(&jointAngles[0], 0, sizeof(jointAngles));
+  std::memset(&jointCurrents[0], 0, sizeof(jointCurrents));
+  std::memset(&jointTemperatures[0], 0, sizeof(jointTemperatures));
+  std::memset(&jointStatuses[0], 0, sizeof(jointStatuses));
+  std::memset(&keys[0], 0, sizeof(keys));
+  batteryLevel = batteryCurrent = batteryTemperature = batteryCharging = nullptr;
+
+  // Offsets and lengths of all values including their type markers
+  std::vector<std::pair<size_t, size_t>> values;
+
+  MsgPack::parse(receivedPacket, size,
+
+    // Most data is encoded as float 32
+    [this, &values](const std::string& key, const unsigned char* p)
+    {
+      values.emplace_back(p - 1 - receivedPacket, 5);
+
+      const std::string::size_type pos = key.find(":");
+      ASSERT(pos != std::string::npos);
+      const std::string category = key.substr(0, pos);
+      const int index = std::stoi(key.substr(pos + 1));
+
+      if(category == "Current")
+        jointCurrents[jointMappings[index]] = p;
+      else if(category == "Position")
+        jointAngles[jointMappings[index]] = p;
+      else if(category == "Temperature")
+        jointTemperatures[jointMappings[index]] = p;
+      else if(category == "FSR")
+        fsrs[index / FsrSensors::numOfFsrSensors][index % FsrSensors::numOfFsrSensors] = p;
+      else if(category == "Accelerometer")
+        accs[index] = p;
+      else if(category == "Gyroscope")
+        gyros[index] = p;
+      else if(category == "Angles")
+        torsoAngles[index] = p;
+      else if(category == "Touch")
+        keys[keyMappings[index]] = p;
+      else if(category == "Battery")
+      {
+        if(index == 0)
+          batteryLevel = p;
+        else if(index == 1)
+          batteryCharging = p;
+        else if(index == 2)
+          batteryCurrent = p;
+        else
+          batteryTemperature = p;
+      }
+      else if(category != "Sonar" && category != "Stiffness")
+        OUTPUT_WARNING("Unknown key " << key);
+    },
+
+    // Only joint temperature statuses are encoded as positive fixint
+    [this, &values](const std::string& key, const unsigned char* p)
+    {
+      values.emplace_back(p - receivedPacket, 1);
+
+      const std::string::size_type pos = key.find(":");
+      ASSERT(pos != std::string::npos);
+      const std::string category = key.substr(0, pos);
+      const int index = std::stoi(key.substr(pos + 1));
+
+      if(category == "Status")
+        jointStatuses[jointMappings[index]] = p;
+      else
+        OUTPUT_WARNING("Unknown key " << key);
+    },
+
+    // Ignore strings
+    [](const std::string& key, const unsigned char* p, size_t size) {});
+
+  // Everything between the values is the layout. It must not change in later packets.
+  std::memcpy(layoutPacket, receivedPacket, size);
+  layoutPacketSize = size;
+  layoutRanges.clear();
+  std::sort(values.begin(), values.end());
+  size_t offset = 0;
+  for(const auto& value : values)
+  {
+    if(value.first > offset)
+      layoutRanges.emplace_back(offset, value.first - offset);
+    offset = std::max(offset, value.first + value.second);
   }
+  if(size > offset)
+    layoutRanges.emplace_back(offset, size - offset);
+}
+
+bool NaoProvider::hasSameLayout(size_t size) const
+{
+  if(size != layoutPacketSize)
+    return false;
+  for(const auto& range : layoutRanges)
+    if(std::memcmp(receivedPacket + range.first, layoutPacket + range.first, range.second))
+      return false;
+  return true;
+}
+
+void NaoProvider::initPacketToSend()
+{
+  // Please note that the code assumes that the order of sensors and actuators is the same
+  unsigned char* p = packetToSend;
+  MsgPack::writeMapHeader(10, p);
+
+  // Determine addresses for target positions
+  MsgPack::write("Position", p);
+  MsgPack::writeArrayHeader(Joints::numOfJoints - 1, p);
+  for(int i = 0; i < Joints::numOfJoints - 1; ++i)
+    jointRequests[jointMappings[i]] = MsgPack::write(0.f, p);
+
+  // Determine addresses for stiffnesses
+  MsgPack::write("Stiffness", p);
+  MsgPack::writeArrayHeader(Joints::numOfJoints - 1, p);
+  for(int i = 0; i < Joints::numOfJoints - 1; ++i)
+    jointStiffnesses[jointMappings[i]] = MsgPack::write(0.f, p);
+
+  // Determine addresses for leds
+  writeLEDs("REar", rightEarMappings, LEDRequest::chestRed - LEDRequest::earsRight0Deg, p);
+  writeLEDs("LEar", leftEarMappings, LEDRequest::earsRight0Deg - LEDRequest::earsLeft0Deg, p);
+  writeLEDs("Chest", chestMappings, LEDRequest::headRearLeft0 - LEDRequest::chestRed, p);
+  writeLEDs("LEye", leftEyeMappings, LEDRequest::faceRightRed0Deg - LEDRequest::faceLeftRed0Deg, p);
+  writeLEDs("REye", rightEyeMappings, LEDRequest::earsLeft0Deg - LEDRequest::faceRightRed0Deg, p);
+  writeLEDs("LFoot", leftFootMappings, LEDRequest::footRightRed - LEDRequest::footLeftRed, p);
+  writeLEDs("RFoot", rightFootMappings, LEDRequest::numOfLEDs - LEDRequest::footRightRed, p);
+  writeLEDs("Skull", skullMappings, LEDRequest::footLeftRed - LEDRequest::headRearLeft0, p);
+
+  packetToSendSize = static_cast<int>(p - packetToSend);
+  ASSERT(packetToSendSize <= static_cast<int>(sizeof(packetToSend)));
 }
 
 void NaoProvider::writeLEDs(const std::string category, const LEDRequest::LED* ledMappings, int numOfLEDs, unsigned char*& p)
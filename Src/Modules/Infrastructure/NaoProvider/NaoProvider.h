@@ -20,6 +20,7 @@
 #include "Representations/Infrastructure/SensorData/KeyStates.h"
 #include "Representations/Infrastructure/SensorData/SystemSensorData.h"
 #include "Tools/Module/Module.h"
+#include <vector>
 
 MODULE(NaoProvider,
 {,
@@ -61,7 +62,10 @@ class NaoProvider : public NaoProviderBase
   int socket; /**< Socket to connect to LoLA. */
   unsigned char receivedPacket[896]; /**< The last packet received from LoLA. */
   unsigned char packetToSend[1000]; /**< The packet to send to LoLA. */
-  size_t packetToSendSize; /**< The size of the packet to send. */
+  size_t packetToSendSize = 0; /**< The size of the packet to send. */
+  unsigned char layoutPacket[sizeof(receivedPacket)]; /**< A copy of the packet the addresses below were determined from. */
+  size_t layoutPacketSize = 0; /**< The size of the packet the addresses below were determined from. */
+  std::vector<std::pair<size_t, size_t>> layoutRanges; /**< Offsets and lengths of all parts of layoutPacket that are not values, i.e. keys and headers. */
 
   std::array<std::array<const unsigned char*, FsrSensors::numOfFsrSensors>, Legs::numOfLegs> fsrs; /**< The addresses of fsr data inside the receivedPacket. */
   std::array<const unsigned char*, 3> gyros; /**< The addresses of gyro data inside receivedPacket. */
@@ -123,9 +127,29 @@ class NaoProvider : public NaoProviderBase
    * Wait for a packet from LoLA and accept it. The packet is present in the
    * field receivedPacket. If this is the first packet accepted, all the pointers
    * intended to point into receivedPacket and packetToSend are initialized.
+   * For all further packets, it is only checked whether their layout is still
+   * the same. Otherwise, the pointers into receivedPacket are determined again.
    */
   void receivePacket();
 
+  /**
+   * Parse receivedPacket and determine the addresses of all values in it.
+   * In addition, remember the ranges of the packet that contain its layout.
+   * @param size The size of the packet received.
+   */
+  void parseLayout(size_t size);
+
+  /**
+   * Checks whether receivedPacket still has the layout parsed before, i.e.
+   * it has the same size and all keys and headers are at the same offsets.
+   * @param size The size of the packet received.
+   * @return Is the layout unchanged?
+   */
+  bool hasSameLayout(size_t size) const;
+
+  /** Initialize the packet to send to LoLA and the pointers to the values in it. */
+  void initPacketToSend();
+
   /**
    * Write a range of leds to the packet to send and initialise the pointers
    * intended to point into packetToSend for this range.
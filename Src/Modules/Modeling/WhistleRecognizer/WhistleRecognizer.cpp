@@ -37,25 +37,28 @@ WhistleRecognizer::WhistleRecognizer()
   }
 
   // Allocate memory for FFTW plans
-  samples = fftw_alloc_real(bufferSize * 2);
-  std::memset(samples, 0, sizeof(double) * bufferSize * 2);
-  spectrum = fftw_alloc_complex(bufferSize + 1);
-  correlation = fftw_alloc_real(bufferSize * 2);
+  samples = fftwf_alloc_real(bufferSize * 2);
+  std::memset(samples, 0, sizeof(float) * bufferSize * 2);
+  product = fftwf_alloc_complex(bufferSize + 1);
+  correlation = fftwf_alloc_real(bufferSize * 2);
 
-  // Create FFTW plans
+  // Create FFTW plans. The forward plan is executed with the spectrum of each channel.
+  // This is possible, because all memory allocated by fftwf_alloc_complex has the same alignment.
   SYNC;
-  fft = fftw_plan_dft_r2c_1d(bufferSize * 2, samples, spectrum, FFTW_MEASURE);
-  ifft = fftw_plan_dft_c2r_1d(bufferSize * 2, spectrum, correlation, FFTW_MEASURE);
+  fft = fftwf_plan_dft_r2c_1d(bufferSize * 2, samples, product, FFTW_MEASURE);
+  ifft = fftwf_plan_dft_c2r_1d(bufferSize * 2, product, correlation, FFTW_MEASURE);
 }
 
 WhistleRecognizer::~WhistleRecognizer()
 {
   SYNC;
-  fftw_destroy_plan(ifft);
-  fftw_destroy_plan(fft);
-  fftw_free(correlation);
-  fftw_free(spectrum);
-  fftw_free(samples);
+  fftwf_destroy_plan(ifft);
+  fftwf_destroy_plan(fft);
+  for(fftwf_complex* spectrum : spectra)
+    fftwf_free(spectrum);
+  fftwf_free(correlation);
+  fftwf_free(product);
+  fftwf_free(samples);
 }
 
 void WhistleRecognizer::update(Whistle& theWhistle)
@@ -87,6 +90,9 @@ void WhistleRecognizer::update(Whistle& theWhistle)
   buffers.resize(theAudioData.channels);
   for(auto& buffer : buffers)
     buffer.reserve(bufferSize);
+  while(spectra.size() < buffers.size())
+    spectra.emplace_back(fftwf_alloc_complex(bufferSize + 1));
+  volumes.resize(buffers.size());
 
   // Append current samples to buffers and sample down if necessary
   ASSERT(theAudioData.sampleRate % sampleRate == 0);
@@ -120,10 +126,10 @@ void WhistleRecognizer::update(Whistle& theWhistle)
   // Record a whistle.
   DEBUG_RESPONSE_ONCE("module:WhistleRecognizer:record")
   {
-    if(buffers[firstBuffer].full())
+    if(buffers[firstBuffer].full() && transform(buffers[firstBuffer], spectra[firstBuffer], volumes[firstBuffer], true))
     {
       Signature signature;
-      signature.selfCorrelation = correlate(signature.spectrum, buffers[firstBuffer], true);
+      signature.selfCorrelation = correlate(signature.spectrum, spectra[firstBuffer], volumes[firstBuffer], true);
       if(signature.selfCorrelation > 0)
       {
         signature.name = selectedName;
@@ -174,6 +180,12 @@ void WhistleRecognizer::update(Whistle& theWhistle)
       }
     }
 
+    // The spectrum of each channel is computed only once and then correlated with all signatures.
+    std::vector<bool> loudEnough(buffers.size(), false);
+    for(size_t i = 0; i < buffers.size(); ++i)
+      if(!theDamageConfigurationHead.audioChannelsDefect[i] && buffers[i].full())
+        loudEnough[i] = transform(buffers[i], spectra[i], volumes[i]);
+
     const Signature* bestSignature = nullptr;
 
     for(auto& signature : signatures)
@@ -186,9 +198,9 @@ void WhistleRecognizer::update(Whistle& theWhistle)
         for(size_t i = 0; i < buffers.size(); ++i)
           if(theDamageConfigurationHead.audioChannelsDefect[i] || !buffers[i].full())
             ++defects;
-          else
+          else if(loudEnough[i])
           {
-            const float channelCorrelation = correlate(signature.spectrum, buffers[i]);
+            const float channelCorrelation = correlate(signature.spectrum, spectra[i], volumes[i]);
             if(channelCorrelation > bestChannelCorrelation)
             {
               bestChannelCorrelation = channelCorrelation;
@@ -242,31 +254,29 @@ void WhistleRecognizer::update(Whistle& theWhistle)
   SEND_DEBUG_IMAGE("module:WhistleRecognizer:spectra", canvas, PixelTypes::Edge2);
 }
 
-float WhistleRecognizer::correlate(std::vector<Vector2d>& signature, const RingBuffer<AudioData::Sample>& buffer,
-                                      bool record)
+bool WhistleRecognizer::transform(const RingBuffer<AudioData::Sample>& buffer, fftwf_complex* spectrum, float& volume, bool record)
 {
   // Compute volume of samples.
-  float volume = 0;
+  volume = 0;
   for(AudioData::Sample sample : buffer)
     volume = std::max(volume, std::abs(static_cast<float>(sample)));
 
   // Abort if not loud enough.
   if(volume == 0 || (!record && volume < (std::is_same<AudioData::Sample, short>::value ? std::numeric_limits<short>::max() : 1) * minVolume))
-    return 0.f;
+    return false;
 
-  // Copy samples to FFTW input and normalize them.
-  const double factor = 1.0 / volume;
+  // Copy samples to FFTW input.
   for(size_t i = 0; i < buffer.size(); ++i)
-    samples[i] = buffer[i] * factor;
+    samples[i] = static_cast<float>(buffer[i]);
 
   // samples -> spectrum
-  fftw_execute(fft);
+  fftwf_execute_dft_r2c(fft, samples, spectrum);
 
   COMPLEX_IMAGE("module:WhistleRecognizer:spectra")
   {
-    for(unsigned x = 0; x < signature.size(); ++x)
+    for(unsigned x = 0; x <= bufferSize; ++x)
     {
-      const Vector2d complex(spectrum[x][0], spectrum[x][1]);
+      const Vector2f complex(spectrum[x][0] / volume, spectrum[x][1] / volume);
       const unsigned amplitude = std::min(static_cast<unsigned>(complex.norm()), canvas.height);
       if(amplitude > 0)
       {
@@ -278,15 +288,20 @@ float WhistleRecognizer::correlate(std::vector<Vector2d>& signature, const RingB
     }
   }
 
+  return true;
+}
+
+float WhistleRecognizer::correlate(std::vector<Vector2d>& signature, const fftwf_complex* spectrum, float volume, bool record)
+{
   if(record)
   {
-    // Store conjugate spectrum as signature and self-correlate input.
+    // Store the normalized conjugate spectrum as signature and self-correlate input.
     signature.resize(bufferSize + 1);
     for(size_t i = 0; i < signature.size(); ++i)
     {
-      signature[i] = Vector2d(spectrum[i][0], -spectrum[i][1]);
-      spectrum[i][0] = sqr(spectrum[i][0]) + sqr(spectrum[i][1]);
-      spectrum[i][1] = 0;
+      signature[i] = Vector2d(spectrum[i][0] / volume, -spectrum[i][1] / volume);
+      product[i][0] = (sqr(spectrum[i][0]) + sqr(spectrum[i][1])) / volume;
+      product[i][1] = 0;
     }
   }
   else
@@ -295,9 +310,10 @@ float WhistleRecognizer::correlate(std::vector<Vector2d>& signature, const RingB
     ASSERT(signature.size() == bufferSize + 1);
     for(size_t i = 0; i < signature.size(); ++i)
     {
-      const double spectrumi0 = spectrum[i][0];
-      spectrum[i][0] = spectrumi0 * signature[i][0] - spectrum[i][1] * signature[i][1];
-      spectrum[i][1] = spectrum[i][1] * signature[i][0] + spectrumi0 * signature[i][1];
+      const float signature0 = static_cast<float>(signature[i][0]);
+      const float signature1 = static_cast<float>(signature[i][1]);
+      product[i][0] = spectrum[i][0] * signature0 - spectrum[i][1] * signature1;
+      product[i][1] = spectrum[i][1] * signature0 + spectrum[i][0] * signature1;
     }
   }
 
@@ -305,7 +321,7 @@ float WhistleRecognizer::correlate(std::vector<Vector2d>& signature, const RingB
   {
     for(unsigned x = 0; x < signature.size(); ++x)
     {
-      const Vector2d complex(spectrum[x][0], spectrum[x][1]);
+      const Vector2f complex(product[x][0] / volume, product[x][1] / volume);
       const unsigned amplitude = std::min(static_cast<unsigned>(std::sqrt(complex.norm())), canvas.height);
       if(amplitude > 0)
       {
@@ -317,14 +333,15 @@ float WhistleRecognizer::correlate(std::vector<Vector2d>& signature, const RingB
     }
   }
 
-  // spectrum -> correlation
-  fftw_execute(ifft);
+  // product -> correlation
+  fftwf_execute(ifft);
 
   // Find best correlation.
-  double bestCorrelation = 0;
+  float bestCorrelation = 0;
   for(size_t i = 0; i < bufferSize * 2; ++i)
     if(std::abs(correlation[i]) > bestCorrelation)
       bestCorrelation = std::abs(correlation[i]);
 
-  return static_cast<float>(std::sqrt(bestCorrelation) / bufferSize / 2);
+  // The spectrum was not normalized. The signature was.
+  return std::sqrt(bestCorrelation / volume) / bufferSize / 2;
 }
@@ -61,11 +61,13 @@ class WhistleRecognizer : public WhistleRecognizerBase
   bool hasRecorded = false; /**< Was audio recorded in the previous cycle? */
   int samplesRequired = 0; /** The number of new samples required. */
   size_t sampleIndex = 0; /** Index of next sample to process for subsampling. */
-  double* samples; /**< The samples after normalization. */
-  fftw_complex* spectrum; /**< The spectrum of the samples. */
-  double* correlation; /**< The correlation with the signature. */
-  fftw_plan fft; /**< The plan to compute the FFT. */
-  fftw_plan ifft; /**< The plan to compute the inverse FFT. */
+  float* samples; /**< The samples as input of the FFT. */
+  std::vector<fftwf_complex*> spectra; /**< The spectra of the samples of all channels. */
+  std::vector<float> volumes; /**< The volumes of all channels, by which their correlations are normalized. */
+  fftwf_complex* product; /**< The product of a spectrum and a signature. */
+  float* correlation; /**< The correlation with the signature. */
+  fftwf_plan fft; /**< The plan to compute the FFT. */
+  fftwf_plan ifft; /**< The plan to compute the inverse FFT. */
   float bestCorrelation = 1.f; /**< The best correlation since the last network packet was sent twice. */
   bool bestUpdated = false; /**< Was the best correlation updated since the last network packet was sent? */
   Image<PixelTypes::Edge2Pixel> canvas; /**< Canvas for drawing spectra. */
@@ -77,14 +79,26 @@ class WhistleRecognizer : public WhistleRecognizerBase
   void update(Whistle& theWhistle) override;
 
   /**
-   * Correlate the samples recorded with a signature spectrum.
-   * @param signature The spectrum of a recorded whistle.
+   * Computes the spectrum of the samples recorded. The samples are not
+   * normalized. Since the transform is linear, this is done by the
+   * correlation instead.
    * @param buffer The samples recorded.
+   * @param spectrum The spectrum computed. It has bufferSize + 1 entries.
+   * @param volume The maximum absolute sample is returned here.
+   * @param record Compute the spectrum even if the volume is below the minimum volume.
+   * @return Was the volume high enough? Otherwise, the spectrum was not computed.
+   */
+  bool transform(const RingBuffer<AudioData::Sample>& buffer, fftwf_complex* spectrum, float& volume, bool record = false);
+
+  /**
+   * Correlate the spectrum of the samples recorded with a signature spectrum.
+   * @param signature The spectrum of a recorded whistle.
+   * @param spectrum The spectrum of the samples recorded.
+   * @param volume The volume of the samples recorded. The correlation is normalized by it.
    * @param record Record into the parameter "signature" instead of correlating with it.
-   * @return The correlation between signature and buffer. 0 if the volume was too low.
+   * @return The correlation between signature and spectrum.
    */
-  float correlate(std::vector<Vector2d>& signature, const RingBuffer<AudioData::Sample>& buffer,
-                  bool record = false);
+  float correlate(std::vector<Vector2d>& signature, const fftwf_complex* spectrum, float volume, bool record = false);
 
 public:
   WhistleRecognizer();
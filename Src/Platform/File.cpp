@@ -5,7 +5,7 @@
 #include "File.h"
 #include "BHAssert.h"
 
-#ifndef TARGET_TOOL
+#if !defined TARGET_TOOL || defined TOOL_WITH_SETTINGS
 #include "Tools/Global.h"
 #include "Tools/Settings.h"
 #endif
@@ -127,7 +127,7 @@ std::list<std::string> File::getConfigDirs()
 {
   std::list<std::string> dirs;
   const std::string configDir = std::string(getBHDir()) + "/Config/";
-#ifndef TARGET_TOOL
+#if !defined TARGET_TOOL || defined TOOL_WITH_SETTINGS
   if(Global::settingsExist())
   {
     dirs.push_back(configDir + "Robots/" + Global::getSettings().headName + "/Head/");
@@ -1,6 +1,121 @@
 #include "Platform/Memory.h"
 
 #include <cstdlib>
+#ifdef TARGET_ROBOT
+#include <malloc.h>
+#include <new>
+#include <sys/mman.h>
+
+static thread_local bool allocationsMonitored = false; /**< Are heap allocations counted in this thread? */
+static thread_local unsigned monitoredAllocations = 0; /**< The number of allocations counted in this thread. */
+
+/**
+ * Allocates memory for the replaced global allocation operators. It counts
+ * allocations while monitoring is switched on. Nothing is reported here,
+ * because reporting would allocate memory itself.
+ * @param size The number of bytes requested.
+ * @param alignment The alignment requested. It is at least the one of malloc.
+ * @return The memory or nullptr if it could not be allocated.
+ */
+static void* allocate(std::size_t size, std::size_t alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+{
+  if(allocationsMonitored)
+    ++monitoredAllocations;
+  if(!size)
+    size = 1;
+  if(alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    return std::malloc(size);
+  void* ptr;
+  return posix_memalign(&ptr, alignment, size) ? nullptr : ptr;
+}
+
+void* operator new(std::size_t size)
+{
+  void* ptr = allocate(size);
+  if(!ptr)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+  return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+  void* ptr = allocate(size, static_cast<std::size_t>(alignment));
+  if(!ptr)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+  return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+// All variants allocate memory that can be freed with free().
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+  std::free(ptr);
+}
+#endif
 
 void* Memory::alignedMalloc(size_t size, size_t alignment)
 {
@@ -15,3 +130,41 @@ void Memory::alignedFree(void* ptr)
 {
   free(ptr);
 }
+
+bool Memory::lockAndPrefault(size_t stackSize)
+{
+#ifdef TARGET_ROBOT
+  // Freed memory stays in the heap and large blocks are not mapped separately,
+  // so that locked pages are reused instead of being faulted in again.
+  mallopt(M_TRIM_THRESHOLD, -1);
+  mallopt(M_MMAP_MAX, 0);
+  if(mlockall(MCL_CURRENT | MCL_FUTURE))
+    return false;
+
+  // Touch each page of the stack once
+  volatile unsigned char* stack = static_cast<unsigned char*>(alloca(stackSize));
+  for(size_t i = 0; i < stackSize; i += 4096)
+    stack[i] = 0;
+  return true;
+#else
+  return false;
+#endif
+}
+
+void Memory::monitorAllocations(bool monitor)
+{
+#ifdef TARGET_ROBOT
+  allocationsMonitored = monitor;
+#endif
+}
+
+unsigned Memory::getMonitoredAllocations()
+{
+#ifdef TARGET_ROBOT
+  const unsigned allocations = monitoredAllocations;
+  monitoredAllocations = 0;
+  return allocations;
+#else
+  return 0;
+#endif
+}
@@ -28,6 +28,18 @@ void Thread::threadStart(const std::function<void()>& lambda)
   terminated.post();
 }
 
+bool Thread::pinCurrentThread(int core)
+{
+#ifdef TARGET_ROBOT
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(core, &cpus);
+  return !pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+#else
+  return false;
+#endif
+}
+
 const std::string Thread::getCurrentThreadName()
 {
   char cname[16];
@@ -9,4 +9,27 @@ namespace Memory
 
   /** Free aligned memory. */
   void alignedFree(void* ptr);
+
+  /**
+   * Lock all current and future memory of the process into RAM, keep freed
+   * heap memory instead of returning it to the system, and pre-fault the
+   * stack of the calling thread. This is only done on the robot.
+   * @param stackSize The number of bytes of the stack that are touched.
+   * @return Was the memory locked?
+   */
+  bool lockAndPrefault(size_t stackSize);
+
+  /**
+   * Switch counting the heap allocations of the calling thread on or off.
+   * Allocations are only counted on the robot.
+   * @param monitor Count allocations from now on?
+   */
+  void monitorAllocations(bool monitor);
+
+  /**
+   * Returns the number of heap allocations counted in the calling thread
+   * and resets the counter.
+   * @return The number of allocations while monitoring was switched on.
+   */
+  unsigned getMonitoredAllocations();
 };
@@ -8,24 +8,98 @@
 
 #include "DebugHandler.h"
 #include "Platform/BHAssert.h"
-#include "Tools/Streams/OutStreams.h"
+#include "Platform/Time.h"
 #include "Tools/Streams/InStreams.h"
+#include <algorithm>
 #include <limits>
+#include <string>
+#include <snappy-c.h>
 
 DebugHandler::DebugHandler(MessageQueue& in, MessageQueue& out, int maxPacketSendSize, int maxPacketReceiveSize) :
   TcpConnection(0, 9999, TcpConnection::receiver, maxPacketSendSize, maxPacketReceiveSize),
   in(in),
   out(out)
-{}
+{
+  // Images would otherwise use all the bandwidth, starving drawings, plots, and timing data.
+  setBudgets(ImageBudgets());
+  lastBudgetUpdate = lastDropReport = Time::getCurrentSystemTime();
+}
+
+void DebugHandler::setBudget(MessageID id, unsigned bytesPerSecond)
+{
+  budgets[id].bytesPerSecond = bytesPerSecond;
+  budgets[id].bytes = static_cast<float>(bytesPerSecond);
+}
+
+void DebugHandler::setBudgets(const ImageBudgets& imageBudgets)
+{
+  setBudget(idCameraImage, imageBudgets.cameraImage);
+  setBudget(idDebugImage, imageBudgets.debugImage);
+  setBudget(idJPEGImage, imageBudgets.jpegImage);
+}
+
+void DebugHandler::applyBudgets()
+{
+  const unsigned now = Time::getCurrentSystemTime();
+  const float seconds = static_cast<float>(now - lastBudgetUpdate) * 0.001f;
+  lastBudgetUpdate = now;
+
+  // The buckets hold at most the budget of one second, so bursts are limited.
+  for(Budget& budget : budgets)
+    if(budget.bytesPerSecond)
+      budget.bytes = std::min(budget.bytes + seconds * static_cast<float>(budget.bytesPerSecond),
+                              static_cast<float>(budget.bytesPerSecond));
+
+  // A message is sent if there is any budget left. It might overdraw the budget, because
+  // single messages can be larger than the budget of a frame.
+  out.removeMessages([this](MessageID id, size_t size)
+  {
+    if(id >= numOfMessageIDs)
+      return false;
+    Budget& budget = budgets[id];
+    if(!budget.bytesPerSecond)
+      return false;
+    else if(budget.bytes <= 0.f)
+    {
+      ++budget.dropped;
+      return true;
+    }
+    budget.bytes -= static_cast<float>(size);
+    return false;
+  });
+
+  if(now - lastDropReport >= 1000)
+  {
+    lastDropReport = now;
+    std::string report;
+    for(int i = 0; i < numOfMessageIDs; ++i)
+      if(budgets[i].dropped)
+      {
+        report += (report.empty() ? "Warning: DebugHandler: Dropped " : ", ") + std::to_string(budgets[i].dropped)
+                  + " " + TypeRegistry::getEnumName(static_cast<MessageID>(i));
+        budgets[i].dropped = 0;
+      }
+    if(!report.empty())
+    {
+      // The text is a single string, because the console concatenates the words of text messages.
+      out.out.text << report + " exceeding the budgets in debugHandler.cfg.";
+      out.out.finishMessage(idText);
+    }
+  }
+}
 
 void DebugHandler::communicate(bool send)
 {
-  if(send && !sendData && !out.isEmpty())
+  if(send && !sendSize && !out.isEmpty())
   {
-    sendSize = out.getStreamedSize();
-    OutBinaryMemory memory(sendSize);
-    memory << out;
-    sendData = reinterpret_cast<unsigned char*>(memory.obtainData());
+    applyBudgets();
+
+    // The queue is compressed directly from its buffer into the packet, which is reused.
+    const size_t maxSize = snappy_max_compressed_length(out.getStreamedSize());
+    if(sendData.size() < maxSize)
+      sendData.resize(maxSize);
+    sendSize = maxSize;
+    VERIFY(snappy_compress(out.getStreamedData(), out.getStreamedSize(), sendData.data(), &sendSize) == SNAPPY_OK);
     out.clear();
   }
 
@@ -33,12 +107,8 @@ void DebugHandler::communicate(bool send)
   int receivedSize = 0;
 
   ASSERT(sendSize <= std::numeric_limits<int>::max());
-  if(sendAndReceive(sendData, static_cast<int>(sendSize), receivedData, receivedSize) && sendSize)
-  {
-    delete [] sendData;
-    sendData = nullptr;
+  if(sendAndReceive(reinterpret_cast<const unsigned char*>(sendData.data()), static_cast<int>(sendSize), receivedData, receivedSize) && sendSize)
     sendSize = 0;
-  }
 
   if(receivedSize > 0)
   {
@@ -10,14 +10,40 @@
 
 #include "Tools/Debugging/TcpConnection.h"
 #include "Tools/MessageQueue/MessageQueue.h"
+#include "Tools/Streams/AutoStreamable.h"
+#include <vector>
 
 class DebugHandler : TcpConnection
 {
+public:
+  /** The bandwidth budgets of the images (uncompressed, in bytes per second). 0 means unlimited. */
+  STREAMABLE(ImageBudgets,
+  {,
+    (unsigned)(2000000) cameraImage, /**< The budget for camera images. */
+    (unsigned)(2000000) debugImage, /**< The budget for debug images. */
+    (unsigned)(1000000) jpegImage, /**< The budget for JPEG images. */
+  });
+
 private:
+  /**
+   * A token bucket that limits the bandwidth used by messages of a certain type.
+   * Messages of types without a budget are always sent.
+   */
+  struct Budget
+  {
+    unsigned bytesPerSecond = 0; /**< The bandwidth granted. 0 means unlimited. */
+    float bytes = 0.f; /**< The number of bytes that can currently be sent. Might be negative. */
+    unsigned dropped = 0; /**< The number of messages dropped since the last report. */
+  };
+
   MessageQueue& in; /**< Incoming debug data is stored here. */
   MessageQueue& out; /**< Outgoing debug data is stored here. */
 
-  unsigned char* sendData = nullptr; /**< The data to send next. */
+  Budget budgets[numOfMessageIDs]; /**< The bandwidth budgets of all message types. */
+  unsigned lastBudgetUpdate = 0; /**< The system time when the budgets were refilled the last time. */
+  unsigned lastDropReport = 0; /**< The system time when dropped messages were reported the last time. */
+
+  std::vector<char> sendData; /**< The compressed packet to send next. Its memory is reused for all packets. */
   size_t sendSize = 0; /**< The size of the data to send next. */
 
 public:
@@ -32,9 +58,19 @@ public:
   DebugHandler(MessageQueue& in, MessageQueue& out, int maxPacketSendSize = 0, int maxPacketReceiveSize = 0);
 
   /**
-   * Delete buffered packet if needed.
+   * Limits the bandwidth used by messages of a certain type. Messages exceeding
+   * their budget are dropped before they are sent. Messages of other types
+   * are always sent, i.e. they have priority.
+   * @param id The type of the messages.
+   * @param bytesPerSecond The bandwidth granted (uncompressed). 0 means unlimited.
    */
-  ~DebugHandler() {if(sendData) delete [] sendData;}
+  void setBudget(MessageID id, unsigned bytesPerSecond);
+
+  /**
+   * Sets the budgets of all image types.
+   * @param imageBudgets The budgets, e.g. read from the file debugHandler.cfg.
+   */
+  void setBudgets(const ImageBudgets& imageBudgets);
 
   /**
    * The method performs the communication.
@@ -42,4 +78,11 @@ public:
    * @param send Send outgoing queue?
    */
   void communicate(bool send);
+
+private:
+  /**
+   * Drops the messages from the outgoing queue that exceed their budgets.
+   * Once per second, the numbers of messages dropped are sent as a warning.
+   */
+  void applyBudgets();
 };
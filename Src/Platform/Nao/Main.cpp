@@ -19,12 +19,14 @@
 #include "Tools/Framework/Robot.h"
 #include "Tools/RobotParts/Joints.h"
 #include "Platform/File.h"
+#include "Platform/Time.h"
 #include "Tools/Communication/MsgPack.h"
 #include "Tools/FunctionList.h"
 #include "Tools/Math/Angle.h"
 #include "Tools/Math/Constants.h"
 #include "Tools/Settings.h"
 #include "Tools/Streams/InStreams.h"
+#include "Tools/Streams/TypeInfo.h"
 
 static pid_t bhumanPid = 0;
 static Robot* robot = nullptr;
@@ -358,8 +360,11 @@ int main(int argc, char* argv[])
 
     BH_TRACE_INIT("main");
 
-    // Acquire static data, e.g. about types
+    // Acquire static data, e.g. about types, and unify the type names before the threads need them
+    const unsigned startTime = Time::getRealSystemTime();
     FunctionList::execute();
+    static_cast<void>(TypeInfo::getCurrent());
+    fprintf(stderr, "BHuman: Static data acquired in %d ms.\n", Time::getTimeSince(startTime));
 
     // load first settings instance
     Settings::loaded = Settings::settings.load();
@@ -106,6 +106,14 @@ public:
 
   static void sleep(unsigned ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
 
+  /**
+   * The function pins the calling thread to a single processor core.
+   * This is only done on the robot and ignored on all other platforms.
+   * @param core The index of the core.
+   * @return Was the thread pinned?
+   */
+  static bool pinCurrentThread(int core);
+
   /**
    * The function name the thread.
    * Note: Additional debug information can be provided before a '.'
@@ -11,3 +11,15 @@ void Memory::alignedFree(void* ptr)
 {
   _aligned_free(ptr);
 }
+
+bool Memory::lockAndPrefault(size_t)
+{
+  return false;
+}
+
+void Memory::monitorAllocations(bool) {}
+
+unsigned Memory::getMonitoredAllocations()
+{
+  return 0;
+}
@@ -24,6 +24,11 @@ void Thread::threadStart(const std::function<void()>& lambda)
   terminated.post();
 }
 
+bool Thread::pinCurrentThread(int)
+{
+  return false;
+}
+
 void Thread::changePriority()
 {
   if(thread && running)
@@ -0,0 +1,61 @@
+/**
+ * @file ActivationGraph.cpp
+ *
+ * This file implements the management of the name table of the activation graph.
+ *
+ * @author Thomas Röfer
+ */
+
+#include "ActivationGraph.h"
+#include <algorithm>
+
+void ActivationGraph::beginFrame()
+{
+  currentDepth = 0;
+  graph.clear();
+  names.clear();
+  if(++framesSinceKeyFrame >= keyFrameInterval)
+  {
+    framesSinceKeyFrame = 0;
+    firstName = 0;
+    names = nameTable;
+  }
+  else
+    firstName = static_cast<unsigned short>(nameTable.size());
+}
+
+unsigned short ActivationGraph::getIndex(const char* name)
+{
+  const auto i = indicesByPointer.find(name);
+  if(i != indicesByPointer.end())
+    return i->second;
+
+  // Another pointer to the same name is not added twice.
+  unsigned short index;
+  const auto j = indicesByName.find(name);
+  if(j != indicesByName.end())
+    index = j->second;
+  else
+  {
+    ASSERT(nameTable.size() < 0xffff);
+    index = static_cast<unsigned short>(nameTable.size());
+    nameTable.emplace_back(name);
+    indicesByName[nameTable.back()] = index;
+    names.emplace_back(name); // "names" always ends with the end of the name table
+  }
+  indicesByPointer[name] = index;
+  return index;
+}
+
+const std::string& ActivationGraph::getName(unsigned short index) const
+{
+  static const std::string unknown = "?";
+  return index < nameTable.size() ? nameTable[index] : unknown;
+}
+
+void ActivationGraph::onRead()
+{
+  if(nameTable.size() < firstName + names.size())
+    nameTable.resize(firstName + names.size(), "?");
+  std::copy(names.begin(), names.end(), nameTable.begin() + firstName);
+}
@@ -2,6 +2,12 @@
  * @file ActivationGraph.h
  *
  * The graph of executed options and states.
+ * Option and state names are not stored in the nodes themselves. Instead,
+ * they are interned into a name table and the nodes only refer to them by
+ * their indices. Only the names added to the table since the previous frame
+ * are streamed. The whole table is repeated in regular intervals so that
+ * receivers that join later (or a log player that jumps) can resolve all
+ * indices again.
  *
  * @author Thomas Röfer
  */
@@ -10,23 +16,69 @@
 
 #include "Platform/BHAssert.h"
 #include "Tools/Streams/AutoStreamable.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 STREAMABLE(ActivationGraph,
 {
+  static constexpr unsigned keyFrameInterval = 100; /**< The whole name table is streamed every that many frames. */
+
   int currentDepth = 0; /**< This is only used during construction of the graph and therefore not streamed.  */
+  std::vector<std::string> nameTable; /**< All names known to this graph. Nodes refer to them by index. Not streamed. */
+  std::unordered_map<const char* COMMA unsigned short> indicesByPointer; /**< Fast lookup of names that were already interned. Only used during construction. */
+  std::unordered_map<std::string COMMA unsigned short> indicesByName; /**< Lookup for names that are known under another address. Only used during construction. */
+  unsigned framesSinceKeyFrame = keyFrameInterval; /**< Number of frames since the whole name table was streamed. Only used during construction. */
 
   void verify() const;
 
+  /**
+   * Starts a new frame, i.e. clears the graph and determines which part of the
+   * name table will be streamed with it.
+   */
+  void beginFrame();
+
+  /**
+   * Returns the index of a name in the name table. The name is added if it is
+   * not known yet. Looking up a name that was already added through the same
+   * pointer is only a hash of that pointer.
+   * @param name The name. It must stay valid for the lifetime of this object,
+   *             which is the case for string literals.
+   * @return The index of the name.
+   */
+  unsigned short getIndex(const char* name);
+
+  /**
+   * Returns the name for an index.
+   * @param index The index of the name in the name table.
+   * @return The name or "?" if this graph has not received the name yet.
+   */
+  const std::string& getName(unsigned short index) const;
+
+  /**
+   * Adds a node to the graph.
+   * @param option The name of the option.
+   * @param depth The depth of the option in the graph.
+   * @param state The name of the current state of the option.
+   * @param optionTime How long is the option already active (in ms)?
+   * @param stateTime How long is the state already active (in ms)?
+   * @param parameters Descriptions of the parameters of the option. They are moved.
+   */
+  void add(const char* option, int depth, const char* state, int optionTime, int stateTime,
+           std::vector<std::string>&& parameters = std::vector<std::string>());
+
+  /** Integrates the streamed names into the name table. */
+  void onRead();
+
   STREAMABLE(Node,
   {
     Node() = default;
-    Node(const std::string& option, int depth,
-         const std::string& state, int optionTime,
-         int stateTime, const std::vector<std::string>& parameters),
+    Node(unsigned short option, int depth, unsigned short state, int optionTime,
+         int stateTime, std::vector<std::string>&& parameters),
 
-    (std::string) option,
+    (unsigned short)(0) option, /**< The index of the option name in the name table. */
     (int)(0) depth,
-    (std::string) state,
+    (unsigned short)(0) state, /**< The index of the state name in the name table. */
     (int)(0) optionTime,
     (int)(0) stateTime,
     (std::vector<std::string>) parameters,
@@ -37,18 +89,20 @@ STREAMABLE(ActivationGraph,
     graph.reserve(100);
   },
 
+  (unsigned short)(0) firstName, /**< The index of the first entry of "names" in the name table. */
+  (std::vector<std::string>) names, /**< The names that were added to the name table in this frame or the whole table in key frames. */
   (std::vector<Node>) graph,
 });
 
-inline ActivationGraph::Node::Node(const std::string& option, int depth,
-                                   const std::string& state, int optionTime,
-                                   int stateTime, const std::vector<std::string>& parameters) :
+inline ActivationGraph::Node::Node(unsigned short option, int depth,
+                                   unsigned short state, int optionTime,
+                                   int stateTime, std::vector<std::string>&& parameters) :
   option(option),
   depth(depth),
   state(state),
   optionTime(optionTime),
   stateTime(stateTime),
-  parameters(parameters)
+  parameters(std::move(parameters))
 {}
 
 inline void ActivationGraph::verify() const
@@ -56,6 +110,12 @@ inline void ActivationGraph::verify() const
   ASSERT(currentDepth == 0);
 }
 
+inline void ActivationGraph::add(const char* option, int depth, const char* state, int optionTime, int stateTime,
+                                 std::vector<std::string>&& parameters)
+{
+  graph.emplace_back(getIndex(option), depth, getIndex(state), optionTime, stateTime, std::move(parameters));
+}
+
 STREAMABLE_WITH_BASE(TeamActivationGraph, ActivationGraph,
 {,
 });
@@ -14,7 +14,7 @@
 #include <cstdint>
 
 #define BHUMAN_STANDARD_MESSAGE_STRUCT_HEADER  "BHUM"
-#define BHUMAN_STANDARD_MESSAGE_STRUCT_VERSION 11      /**< This should be incremented with each change. */
+#define BHUMAN_STANDARD_MESSAGE_STRUCT_VERSION 12      /**< This should be incremented with each change. */
 #define BHUMAN_STANDARD_MESSAGE_MAX_NUM_OF_PLAYERS 6   /**< The maximum number of players per team. */
 #define BHUMAN_STANDARD_MESSAGE_MAX_NUM_OF_OBSTACLES 7 /**< The maximum number of obstacles that can be transmitted. */
 
@@ -48,8 +48,15 @@
  *                                            This means after streaming it can hold 2,4,6,8 and 10)
  *  uint32_t time1      // < [delta 0..-10] (This will be streamed in relation to the timestamp of
  *                                            the message in range of 0 to -10.)
+ *  float    value4;    // < [reduced]      (This will be streamed as a floating point number with
+ *                                            a reduced precision, i.e. 16 bits, see BitStream.h.)
+ *
+ * All values are packed bit by bit, i.e. a range of [3..12] occupies 4 bits.
  */
 
+class BitReader;
+class BitWriter;
+
 /** The definintion of an NTP message we send - in response to a previously received request. */
 STREAMABLE(BNTPMessage,
 {,
@@ -81,6 +88,18 @@ STREAMABLE(BHumanStandardMessage,
    */
   bool read(const void* data);
 
+  /**
+   * Packs this struct bit by bit, starting with the timestamp.
+   * @param writer The writer that either writes the bits to memory or only counts them.
+   */
+  void write(BitWriter& writer) const;
+
+  /**
+   * Unpacks this struct bit by bit, starting with the timestamp.
+   * @param reader The reader that is positioned behind the magic number.
+   */
+  void read(BitReader& reader);
+
   /** Constructor. */
   BHumanStandardMessage(),
 
@@ -95,16 +114,16 @@ STREAMABLE(BHumanStandardMessage,
   (unsigned) timeOfLastGroundContact, /**< [delta 0..-16320 (64)] The name says it all. */
 
   (float)                robotPoseValidity,   /**< [0..1 (0.0039)] The validity of the RobotPose. */
-  (float)                robotPoseDeviation,  /**< The deviation of the RobotPose. */
-  (std::array<float, 6>) robotPoseCovariance, /**< The covariance matrix of the RobotPose. */
+  (float)                robotPoseDeviation,  /**< [reduced] The deviation of the RobotPose. */
+  (std::array<float, 6>) robotPoseCovariance, /**< [reduced] The covariance matrix of the RobotPose. */
   (unsigned)             timestampLastJumped, /**< [delta 0..-32640 (128)] The timestamp when the localization jumped. */
 
   (unsigned)             ballTimeWhenLastSeen,    /**< The name says it all. */
-  (unsigned)             ballTimeWhenDisappeared, /**< The name says it all. */
-  (unsigned char)        ballSeenPercentage,      /**< The name says it all */
+  (unsigned)             ballTimeWhenDisappeared, /**< [0..16777215] The name says it all. */
+  (unsigned char)        ballSeenPercentage,      /**< [0..100] The name says it all */
   (Vector2f)             ballVelocity,            /**< [-32768..32767 (1)] The ball velocity .*/
   (Vector2f)             ballLastPercept,         /**< [-32768..32767 (1)] The position where the last ball percept was. */
-  (std::array<float, 3>) ballCovariance,          /**< The covariance matrix of the ball position. */
+  (std::array<float, 3>) ballCovariance,          /**< [reduced] The covariance matrix of the ball position. */
 
   (unsigned char) confidenceOfLastWhistleDetection, /**< The name says it all. */
   (unsigned char) channelsUsedForWhistleDetection,  /**< The name says it all. */
@@ -112,7 +131,7 @@ STREAMABLE(BHumanStandardMessage,
 
   (unsigned char)                                    teamActivity,              /**< What team play the robot is doing. */
   (unsigned)                                         timeWhenReachBall,         /**< [delta 0..524280 (8)] The estimate when this robot reaches the ball. */
-  (unsigned)                                         timeWhenReachBallStriker,  /**< [delta 0..524264 (8)] The estimate when this robot reaches the ball if it is striker. */
+  (unsigned)                                         timeWhenReachBallStriker,  /**< [delta 0..524280 (8)] The estimate when this robot reaches the ball if it is striker. */
   (bool[BHUMAN_STANDARD_MESSAGE_MAX_NUM_OF_PLAYERS]) teammateRolesIsGoalkeeper, /**< The role assignment for the whole team. */
   (bool[BHUMAN_STANDARD_MESSAGE_MAX_NUM_OF_PLAYERS]) teammateRolesPlayBall,     /**< The role assignment for the whole team. */
   (int[BHUMAN_STANDARD_MESSAGE_MAX_NUM_OF_PLAYERS])  teammateRolesPlayerIndex,  /**< [-1..6] The role assignment for the whole team. */
@@ -129,18 +148,18 @@ STREAMABLE(BHumanStandardMessage,
 
   /**
    * Obstacle has the attributes covariance, center, left, right, velocity, lastSeen and type.
-   * covariance is streamed as float with the nondiagonal entries as one value.
+   * covariance is streamed as [reduced] floats with the nondiagonal entries as one value.
    * center is streamed in [-32768..32767 (1)].
    * left is streamed in [-32768..32764 (4)].
    * right is streamed in [-32768..32764 (4)].
    * velocity is not streamed at all.
    * lastSeen is streamed in [delta 0..-16320 (64)].
-   * type is streamed in [0..255].
+   * type is streamed in [0..numOfTypes - 1].
    */
-  (std::vector<Obstacle>) obstacles,
+  (std::vector<Obstacle>) obstacles, /**< [0..#_MAX_NUM_OF_OBSTACLES] */
 
   (char) say,
-  (unsigned int) nextTeamTalk,
+  (unsigned int) nextTeamTalk, /**< [delta 0..16320 (64)] */
 
   (bool) requestsNTPMessage,              /**< Whether this robot requests NTP replies from the others. */
   (std::vector<BNTPMessage>) ntpMessages, /**< The NTP replies of this robot to other robots. */
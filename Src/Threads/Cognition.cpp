@@ -10,11 +10,21 @@
 #include "Modules/Infrastructure/LogDataProvider/LogDataProvider.h"
 #include "Platform/SystemCall.h"
 #include "Platform/Thread.h"
+#include "Platform/Time.h"
 
 REGISTER_EXECUTION_UNIT(Cognition)
 
+#ifdef TARGET_ROBOT
+static const unsigned startTime = Time::getRealSystemTime(); /**< The time when the process was started. */
+#endif
+
 thread_local bool Cognition::isUpper = false;
 
+static const BlackboardSlot<UpperFrameInfo> upperFrameInfoSlot("UpperFrameInfo");
+static const BlackboardSlot<LowerFrameInfo> lowerFrameInfoSlot("LowerFrameInfo");
+static const BlackboardSlot<TeamData> teamDataSlot("TeamData");
+static const BlackboardSlot<BHumanMessageOutputGenerator> bHumanMessageOutputGeneratorSlot("BHumanMessageOutputGenerator");
+
 Cognition::Cognition()
 : theSPLMessageHandler(inTeamMessages, outTeamMessage)
 {
@@ -24,14 +34,14 @@ Cognition::Cognition()
   std::string bcastAddr = UdpComm::getWifiBroadcastAddress();
   theSPLMessageHandler.start(Global::getSettings().teamPort, bcastAddr.c_str());
 #endif
-  Blackboard::getInstance().alloc<UpperFrameInfo>("UpperFrameInfo").time = 100000;
-  Blackboard::getInstance().alloc<LowerFrameInfo>("LowerFrameInfo").time = 100000;
+  Blackboard::getInstance().alloc(upperFrameInfoSlot).time = 100000;
+  Blackboard::getInstance().alloc(lowerFrameInfoSlot).time = 100000;
 }
 
 Cognition::~Cognition()
 {
-  Blackboard::getInstance().free("UpperFrameInfo");
-  Blackboard::getInstance().free("LowerFrameInfo");
+  Blackboard::getInstance().free(upperFrameInfoSlot);
+  Blackboard::getInstance().free(lowerFrameInfoSlot);
 }
 
 bool Cognition::beforeFrame()
@@ -39,12 +49,9 @@ bool Cognition::beforeFrame()
   // read from team comm udp socket
   static_cast<void>(theSPLMessageHandler.receive());
 
-  const FrameInfo* lowerFrameInfo = Blackboard::getInstance().exists("LowerFrameInfo")
-                                    ? static_cast<FrameInfo*>(const_cast<Streamable*>(&Blackboard::getInstance()["LowerFrameInfo"]))
-                                    : nullptr;
-  const FrameInfo* upperFrameInfo = Blackboard::getInstance().exists("UpperFrameInfo")
-                                    ? static_cast<FrameInfo*>(const_cast<Streamable*>(&Blackboard::getInstance()["UpperFrameInfo"]))
-                                    : nullptr;
+  const Blackboard& blackboard = Blackboard::getInstance();
+  const FrameInfo* lowerFrameInfo = blackboard.exists(lowerFrameInfoSlot) ? &blackboard[lowerFrameInfoSlot] : nullptr;
+  const FrameInfo* upperFrameInfo = blackboard.exists(upperFrameInfoSlot) ? &blackboard[upperFrameInfoSlot] : nullptr;
   unsigned lowerFrameTime = lowerFrameInfo ? lowerFrameInfo->time : 0;
   unsigned upperFrameTime = upperFrameInfo ? upperFrameInfo->time : 0;
 
@@ -53,9 +60,14 @@ bool Cognition::beforeFrame()
   lastUpperFrameTime = upperFrameTime;
   lastLowerFrameTime = lowerFrameTime;
 
+  // When the log file replayed contains frames of this thread, exactly these frames are
+  // executed. This reproduces the sequence of frames the robot executed.
+  const bool replayingFrames = SystemCall::getMode() == SystemCall::logFileReplay && LogDataProvider::isReplayingFrames();
+  const bool logFrame = replayingFrames && LogDataProvider::isFrameDataComplete();
+
   // Begin a new frame if either there is data for a new one left over from
   // the previous frame or we have two from which we can choose.
-  if(acceptNext || (upperIsNew && lowerIsNew))
+  if((acceptNext || (upperIsNew && lowerIsNew)) && (logFrame || !replayingFrames))
   {
     // We always switch between upper and lower
     isUpper ^= true;
@@ -84,8 +96,7 @@ bool Cognition::beforeFrame()
   {
     // Wait for another frame to arrive before one can be picked.
     // However, a new frame is accepted when replaying logs.
-    if(LogDataProvider::exists() && LogDataProvider::isFrameDataComplete()
-       && SystemCall::getMode() == SystemCall::logFileReplay)
+    if(logFrame)
       return true;
   }
 
@@ -96,11 +107,11 @@ void Cognition::beforeModules()
 {
   BH_TRACE_MSG("before TeamData");
   // push teammate data in our system
-  if(Blackboard::getInstance().exists("TeamData") &&
-     static_cast<const TeamData&>(Blackboard::getInstance()["TeamData"]).generate)
+  if(Blackboard::getInstance().exists(teamDataSlot) &&
+     Blackboard::getInstance()[teamDataSlot].generate)
   {
     while(!inTeamMessages.empty())
-      static_cast<const TeamData&>(Blackboard::getInstance()["TeamData"]).generate(inTeamMessages.takeBack());
+      Blackboard::getInstance()[teamDataSlot].generate(inTeamMessages.takeBack());
   }
 
   DECLARE_PLOT("module:SPLMessageHandler:standardMessageDataBufferUsageInPercent");
@@ -108,19 +119,28 @@ void Cognition::beforeModules()
 
 void Cognition::afterModules()
 {
-  if(Blackboard::getInstance().exists("BHumanMessageOutputGenerator")
-     && static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()["BHumanMessageOutputGenerator"]).generate
-     && static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()["BHumanMessageOutputGenerator"]).sendThisFrame)
+  if(Blackboard::getInstance().exists(bHumanMessageOutputGeneratorSlot)
+     && Blackboard::getInstance()[bHumanMessageOutputGeneratorSlot].generate
+     && Blackboard::getInstance()[bHumanMessageOutputGeneratorSlot].sendThisFrame)
   {
-    static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()["BHumanMessageOutputGenerator"]).generate(&outTeamMessage);
+    Blackboard::getInstance()[bHumanMessageOutputGeneratorSlot].generate(&outTeamMessage);
 
     BH_TRACE_MSG("before theSPLMessageHandler.send()");
     theSPLMessageHandler.send();
   }
+
+#ifdef TARGET_ROBOT
+  if(!startupReported)
+  {
+    fprintf(stderr, "BHuman: First frame finished %d ms after start.\n", Time::getTimeSince(startTime));
+    startupReported = true;
+  }
+#endif
 }
 
 bool Cognition::afterFrame()
 {
   // If there is already a frame waiting to be processed, do not wait for the next one to arrive.
-  return !acceptNext;
+  // When replaying the frames of a log file, the next one must be waited for anyway.
+  return !acceptNext || (SystemCall::getMode() == SystemCall::logFileReplay && LogDataProvider::isReplayingFrames());
 }
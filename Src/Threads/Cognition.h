@@ -28,6 +28,7 @@ private:
   bool upperIsNew = false; /**< The is unused data from the upper camera thread. */
   bool lowerIsNew = false; /**< The is unused data from the lower camera thread. */
   bool acceptNext = false; /**< Immediately process the frame still waiting. */
+  bool startupReported = false; /**< Was the time until the first frame already reported? */
 
 public:
   thread_local static bool isUpper; /**< The current frame picked is from the upper camera thread. */
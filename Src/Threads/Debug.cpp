@@ -10,6 +10,7 @@
 #include "Debug.h"
 #include "Platform/Time.h"
 #include "Tools/Debugging/Debugging.h"
+#include "Tools/Streams/InStreams.h"
 
 Debug::Debug(const Configuration& config) :
 #ifdef TARGET_ROBOT
@@ -36,6 +37,17 @@ void Debug::init()
 
   BH_TRACE_INIT("Debug");
 
+#ifdef TARGET_ROBOT
+  // read the bandwidth budgets of images
+  InMapFile budgetsFile("debugHandler.cfg");
+  if(budgetsFile.exists())
+  {
+    DebugHandler::ImageBudgets imageBudgets;
+    budgetsFile >> imageBudgets;
+    debugHandler.setBudgets(imageBudgets);
+  }
+#endif
+
   moduleGraphCreator = std::make_unique<ModuleGraphCreator>(config);
 
   // read requests.dat
@@ -119,7 +131,7 @@ bool Debug::main()
     debugSender->removeRepetitions();
 
   // Send messages to the threads
-#ifdef TARGET_SIM
+#ifndef TARGET_ROBOT
   for(DebugSender<MessageQueue>& sender : senders)
     sender.send(true);
   debugSender->send(true);
@@ -132,7 +144,7 @@ bool Debug::main()
   printf("Stopping Debug\n");
   announceStop();
 #endif // NDEBUG
-#endif // TARGET_SIM
+#endif // TARGET_ROBOT
 
   return true;
 }
@@ -9,14 +9,30 @@
 #include "Modules/Infrastructure/NaoProvider/NaoProvider.h" // include must be the first, because of Visual Studio
 #include "Motion.h"
 #include "Modules/Infrastructure/LogDataProvider/LogDataProvider.h"
+#include "Platform/SystemCall.h"
 #include "Platform/Thread.h"
 #include "Platform/Time.h"
 #include "Tools/Framework/Communication.h"
 #include "Tools/Math/Constants.h"
 #include "Tools/Module/ModulePacket.h"
+#include "Tools/Streams/OutStreams.h"
+#include <sstream>
 
 REGISTER_EXECUTION_UNIT(Motion)
 
+static const BlackboardSlot<JointSensorData> jointSensorDataSlot("JointSensorData");
+
+Motion::Motion()
+{
+  cycleHistogram.fill(0);
+}
+
+Motion::~Motion()
+{
+  if(SystemCall::getMode() == SystemCall::physicalRobot && maxCycleDuration.count() > 0)
+    OutTextRawFile("/var/volatile/tmp/motionCycles.txt") << getCycleHistogram();
+}
+
 bool Motion::beforeFrame()
 {
   return LogDataProvider::isFrameDataComplete();
@@ -29,10 +45,17 @@ void Motion::afterModules()
 
 bool Motion::afterFrame()
 {
-  if(Blackboard::getInstance().exists("JointSensorData"))
+  // When replaying log files, the next frame starts as soon as its data arrived.
+  if(SystemCall::getMode() == SystemCall::logFileReplay && LogDataProvider::exists())
+    return FrameExecutionUnit::afterFrame();
+
+  if(Blackboard::getInstance().exists(jointSensorDataSlot))
   {
     BH_TRACE_MSG("before waitForFrameData");
     NaoProvider::waitForFrameData();
+    recordCycle(std::chrono::steady_clock::now());
+    DEBUG_RESPONSE_ONCE("thread:Motion:cycleHistogram")
+      OUTPUT_TEXT(getCycleHistogram());
   }
   else
     Thread::sleep(static_cast<unsigned>(Constants::motionCycleTime * 1000.f));
@@ -40,6 +63,35 @@ bool Motion::afterFrame()
   return FrameExecutionUnit::afterFrame();
 }
 
+void Motion::recordCycle(std::chrono::steady_clock::time_point now)
+{
+  if(lastFrameDataReceived != std::chrono::steady_clock::time_point())
+  {
+    const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(now - lastFrameDataReceived);
+    ++cycleHistogram[std::min(static_cast<size_t>(duration.count() / 1000), cycleHistogram.size() - 1)];
+    if(duration.count() > static_cast<long long>(Constants::motionCycleTime * 1.5e6f))
+      ++missedCycles;
+    maxCycleDuration = std::max(maxCycleDuration, duration);
+  }
+  lastFrameDataReceived = now;
+}
+
+std::string Motion::getCycleHistogram() const
+{
+  unsigned numOfCycles = 0;
+  for(unsigned count : cycleHistogram)
+    numOfCycles += count;
+
+  std::stringstream stream;
+  stream << "Motion cycles relative to " << Constants::motionCycleTime * 1000.f << " ms:\n";
+  for(size_t i = 0; i < cycleHistogram.size(); ++i)
+    if(cycleHistogram[i])
+      stream << (i + 1 == cycleHistogram.size() ? ">=" : "") << i << " ms: " << cycleHistogram[i] << "\n";
+  stream << "cycles: " << numOfCycles << ", missed: " << missedCycles
+         << ", longest: " << maxCycleDuration.count() / 1000.f << " ms";
+  return stream.str();
+}
+
 #if (defined LINUX || defined MACOS)
 #include "Modules/Sensing/FallDownStateDetector/FallDownStateProvider.h"
 #include "Modules/Sensing/InertialDataProvider/InertialDataProvider.h"
@@ -9,6 +9,9 @@
 #pragma once
 
 #include "Tools/Framework/FrameExecutionUnit.h"
+#include <array>
+#include <chrono>
+#include <string>
 
 /**
  * @class Motion
@@ -17,7 +20,27 @@
  */
 class Motion : public FrameExecutionUnit
 {
+  std::array<unsigned, 25> cycleHistogram; /**< Number of cycles per duration in ms. The last entry also counts all longer cycles. */
+  unsigned missedCycles = 0; /**< Number of cycles that took longer than 1.5 LoLA cycles. */
+  std::chrono::microseconds maxCycleDuration = std::chrono::microseconds::zero(); /**< The longest cycle measured. */
+  std::chrono::steady_clock::time_point lastFrameDataReceived; /**< When did waitForFrameData return the last time? */
+
+  /**
+   * Add the duration of the cycle that just ended to the histogram.
+   * @param now The time when the current cycle started.
+   */
+  void recordCycle(std::chrono::steady_clock::time_point now);
+
+  /**
+   * Returns a textual description of the histogram of cycle durations.
+   * @return One line per histogram entry and a summary.
+   */
+  std::string getCycleHistogram() const;
+
 public:
+  Motion();
+  ~Motion();
+
   bool beforeFrame() override;
   void afterModules() override;
   bool afterFrame() override;
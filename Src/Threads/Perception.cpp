@@ -12,6 +12,8 @@
 
 REGISTER_EXECUTION_UNIT(Perception)
 
+static const BlackboardSlot<CameraImage> cameraImageSlot("CameraImage");
+
 bool Perception::beforeFrame()
 {
   return LogDataProvider::isFrameDataComplete() && CameraProvider::isFrameDataComplete();
@@ -28,7 +30,11 @@ void Perception::beforeModules()
 
 bool Perception::afterFrame()
 {
-  if(Blackboard::getInstance().exists("CameraImage"))
+  // When replaying log files, the next frame starts as soon as its data arrived.
+  if(SystemCall::getMode() == SystemCall::logFileReplay && LogDataProvider::exists())
+    return FrameExecutionUnit::afterFrame();
+
+  if(Blackboard::getInstance().exists(cameraImageSlot))
   {
     if(SystemCall::getMode() == SystemCall::physicalRobot)
       Thread::getCurrentThread()->setPriority(10);
@@ -38,11 +38,11 @@ void Card::call()
   }
   ActivationGraph& theActivationGraph = CardRegistry::theInstance->theActivationGraph;
   const size_t activationGraphIndex = theActivationGraph.graph.size();
-  theActivationGraph.graph.emplace_back(_name, ++theActivationGraph.currentDepth, "", CardRegistry::theInstance->currentFrameTime - _context.behaviorStart, 0, std::vector<std::string>());
+  theActivationGraph.add(_name, ++theActivationGraph.currentDepth, "", CardRegistry::theInstance->currentFrameTime - _context.behaviorStart, 0);
   execute();
   if(_context.stateName) \
   {
-    theActivationGraph.graph[activationGraphIndex].state = _context.stateName;
+    theActivationGraph.graph[activationGraphIndex].state = theActivationGraph.getIndex(_context.stateName);
     theActivationGraph.graph[activationGraphIndex].stateTime = CardRegistry::theInstance->currentFrameTime - _context.stateStart;
   }
   --theActivationGraph.currentDepth;
@@ -152,15 +152,15 @@ private:
 #define _CARD_LOAD__MODULE_LOADS_PARAMETERS(...) loadModuleParameters(*this, cardName, fileName, "BehaviorControl/");
 
 #define _CARD_DECLARE(x) _MODULE_JOIN(_CARD_DECLARE_, x)
-#define _CARD_DECLARE_REQUIRES(type) public: const type& the##type = Blackboard::getInstance().alloc<type>(#type);
-#define _CARD_DECLARE_USES(type) public: const type& the##type = Blackboard::getInstance().alloc<type>(#type);
+#define _CARD_DECLARE_REQUIRES(type) public: const type& the##type = Blackboard::getInstance().alloc(BlackboardSlot<type>::get(#type));
+#define _CARD_DECLARE_USES(type) public: const type& the##type = Blackboard::getInstance().alloc(BlackboardSlot<type>::get(#type));
 #define _CARD_DECLARE_CALLS(type) public: _CARD_SKILLS_NAMESPACE::type##Skill& the##type##Skill = *_CARD_SKILL_REGISTRY::theInstance->getSkill<_CARD_SKILLS_NAMESPACE::type##Skill>(#type);
 #define _CARD_DECLARE__MODULE_DEFINES_PARAMETERS(...)
 #define _CARD_DECLARE__MODULE_LOADS_PARAMETERS(...)
 
 #define _CARD_FREE(x) _MODULE_JOIN(_CARD_FREE_, x)
-#define _CARD_FREE_REQUIRES(type) Blackboard::getInstance().free(#type);
-#define _CARD_FREE_USES(type) Blackboard::getInstance().free(#type);
+#define _CARD_FREE_REQUIRES(type) Blackboard::getInstance().free(BlackboardSlot<type>::get(#type));
+#define _CARD_FREE_USES(type) Blackboard::getInstance().free(BlackboardSlot<type>::get(#type));
 #define _CARD_FREE_CALLS(type)
 #define _CARD_FREE__MODULE_DEFINES_PARAMETERS(...)
 #define _CARD_FREE__MODULE_LOADS_PARAMETERS(...)
@@ -179,11 +179,11 @@ private:
       _STREAM_ATTR_##n params4 \
       ActivationGraph& theActivationGraph = registry::theInstance->theActivationGraph; \
       const size_t activationGraphIndex = theActivationGraph.graph.size(); \
-      theActivationGraph.graph.emplace_back(#name, ++theActivationGraph.currentDepth, "", registry::theInstance->currentFrameTime - _context.behaviorStart, 0, _parameters); \
+      theActivationGraph.add(#name, ++theActivationGraph.currentDepth, "", registry::theInstance->currentFrameTime - _context.behaviorStart, 0, std::move(_parameters)); \
       theImplementation->execute(*this); \
       if(_context.stateName) \
       { \
-        theActivationGraph.graph[activationGraphIndex].state = _context.stateName; \
+        theActivationGraph.graph[activationGraphIndex].state = theActivationGraph.getIndex(_context.stateName); \
         theActivationGraph.graph[activationGraphIndex].stateTime = registry::theInstance->currentFrameTime - _context.stateStart; \
       } \
       --theActivationGraph.currentDepth; \
@@ -348,8 +348,8 @@ private:
 #define _SKILL_IMPLEMENTATION_DECLARE_IMPLEMENTS(type) \
   protected: \
     using type = _SKILLS_NAMESPACE::type;
-#define _SKILL_IMPLEMENTATION_DECLARE_REQUIRES(type) public: const type& the##type = Blackboard::getInstance().alloc<type>(#type);
-#define _SKILL_IMPLEMENTATION_DECLARE_USES(type) public: const type& the##type = Blackboard::getInstance().alloc<type>(#type);
+#define _SKILL_IMPLEMENTATION_DECLARE_REQUIRES(type) public: const type& the##type = Blackboard::getInstance().alloc(BlackboardSlot<type>::get(#type));
+#define _SKILL_IMPLEMENTATION_DECLARE_USES(type) public: const type& the##type = Blackboard::getInstance().alloc(BlackboardSlot<type>::get(#type));
 #define _SKILL_IMPLEMENTATION_DECLARE_MODIFIES(type) public: type& the##type = _SKILL_REGISTRY::theInstance->the##type;
 #define _SKILL_IMPLEMENTATION_DECLARE_CALLS(type) public: _SKILLS_NAMESPACE::type##Skill& the##type##Skill = *_SKILL_REGISTRY::theInstance->getSkill<_SKILLS_NAMESPACE::type##Skill>(#type);
 #define _SKILL_IMPLEMENTATION_DECLARE__MODULE_DEFINES_PARAMETERS(...)
@@ -357,8 +357,8 @@ private:
 
 #define _SKILL_IMPLEMENTATION_FREE(x) _MODULE_JOIN(_SKILL_IMPLEMENTATION_FREE_, x)
 #define _SKILL_IMPLEMENTATION_FREE_IMPLEMENTS(type)
-#define _SKILL_IMPLEMENTATION_FREE_REQUIRES(type) Blackboard::getInstance().free(#type);
-#define _SKILL_IMPLEMENTATION_FREE_USES(type) Blackboard::getInstance().free(#type);
+#define _SKILL_IMPLEMENTATION_FREE_REQUIRES(type) Blackboard::getInstance().free(BlackboardSlot<type>::get(#type));
+#define _SKILL_IMPLEMENTATION_FREE_USES(type) Blackboard::getInstance().free(BlackboardSlot<type>::get(#type));
 #define _SKILL_IMPLEMENTATION_FREE_MODIFIES(type)
 #define _SKILL_IMPLEMENTATION_FREE_CALLS(type)
 #define _SKILL_IMPLEMENTATION_FREE__MODULE_DEFINES_PARAMETERS(...)
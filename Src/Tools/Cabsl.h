@@ -183,11 +183,11 @@ protected:
     {
       if(!context.addedToGraph && instance->activationGraph)
       {
-        instance->activationGraph->graph.emplace_back(optionName, instance->activationGraph->currentDepth,
-                                                      context.stateName,
-                                                      instance->_currentFrameTime - context.optionStart,
-                                                      instance->_currentFrameTime - context.stateStart,
-                                                      parameters);
+        instance->activationGraph->add(optionName, instance->activationGraph->currentDepth,
+                                       context.stateName,
+                                       instance->_currentFrameTime - context.optionStart,
+                                       instance->_currentFrameTime - context.stateStart,
+                                       std::move(parameters));
         context.addedToGraph = true;
       }
     }
@@ -370,10 +370,7 @@ public:
   {
     _currentFrameTime = frameTime;
     if(activationGraph && clearActivationGraph)
-    {
-      activationGraph->currentDepth = 0;
-      activationGraph->graph.clear();
-    }
+      activationGraph->beginFrame();
     _theInstance = this;
   }
 
@@ -0,0 +1,267 @@
+/**
+ * @file BitStream.h
+ *
+ * This file declares classes that write and read values with an arbitrary
+ * number of bits to and from a block of memory. They are used to pack the
+ * team messages as tightly as possible. Values are stored starting with
+ * their least significant bit.
+ */
+
+#pragma once
+
+#include "Platform/BHAssert.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Determines the number of bits required to represent all values between 0 and a maximum.
+ * @param max The maximum value.
+ * @return The number of bits required.
+ */
+constexpr unsigned bitsFor(uint32_t max)
+{
+  unsigned bits = 0;
+  while(max)
+  {
+    ++bits;
+    max >>= 1;
+  }
+  return bits;
+}
+
+/**
+ * The parameters of the floating point numbers with reduced precision that are
+ * written and read by the classes below. The default covers magnitudes between
+ * 2^-32 and 2^31 with a relative error of less than 0.1%, which is sufficient
+ * for covariances and deviations.
+ */
+struct ReducedFloat
+{
+  unsigned exponentBits = 6;
+  unsigned mantissaBits = 9;
+};
+
+class BitWriter
+{
+private:
+  uint8_t* data; /**< The memory that is written to or nullptr if the bits are only counted. */
+  uint64_t buffer = 0; /**< The bits that were not written to memory yet. */
+  unsigned bitsInBuffer = 0; /**< The number of bits in the buffer. */
+  size_t numOfBits = 0; /**< The number of bits written so far. */
+
+public:
+  /**
+   * Constructor.
+   * @param data The memory that is written to. If nullptr, the bits are only
+   *             counted, e.g. to determine the size of a message.
+   */
+  explicit BitWriter(void* data = nullptr) : data(reinterpret_cast<uint8_t*>(data)) {}
+
+  /**
+   * Writes the lower bits of a value.
+   * @param value The value. Bits above the ones written are ignored.
+   * @param bits The number of bits to write (0..32).
+   */
+  void writeBits(uint32_t value, unsigned bits)
+  {
+    ASSERT(bits <= 32);
+    numOfBits += bits;
+    if(data)
+    {
+      buffer |= (static_cast<uint64_t>(value) & ((uint64_t(1) << bits) - 1)) << bitsInBuffer;
+      for(bitsInBuffer += bits; bitsInBuffer >= 8; bitsInBuffer -= 8, buffer >>= 8)
+        *data++ = static_cast<uint8_t>(buffer);
+    }
+  }
+
+  void writeBool(bool value)
+  {
+    writeBits(value ? 1 : 0, 1);
+  }
+
+  /**
+   * Writes an unsigned value. Larger values are clipped.
+   * @param value The value.
+   * @param max The largest value that can be represented.
+   */
+  void writeUnsigned(uint32_t value, uint32_t max)
+  {
+    writeBits(std::min(value, max), bitsFor(max));
+  }
+
+  /**
+   * Writes a signed value. Values outside the range are clipped.
+   * @param value The value.
+   * @param min The smallest value that can be represented.
+   * @param max The largest value that can be represented.
+   */
+  void writeSigned(int value, int min, int max)
+  {
+    writeBits(static_cast<uint32_t>(std::min(std::max(value, min), max) - min), bitsFor(static_cast<uint32_t>(max - min)));
+  }
+
+  /**
+   * Writes a floating point value that is quantized to a given number of steps within a range.
+   * Values outside the range are clipped.
+   * @param value The value.
+   * @param min The smallest value that can be represented.
+   * @param max The largest value that can be represented.
+   * @param bits The number of bits used, i.e. the range is divided into 2^bits - 1 steps.
+   */
+  void writeQuantized(float value, float min, float max, unsigned bits)
+  {
+    const uint32_t steps = static_cast<uint32_t>((uint64_t(1) << bits) - 1);
+    const float normalized = (std::min(std::max(value, min), max) - min) / (max - min);
+    writeBits(static_cast<uint32_t>(std::lround(normalized * static_cast<float>(steps))), bits);
+  }
+
+  /**
+   * Writes a floating point value with reduced precision. It is stored as a sign bit,
+   * the exponent, and the mantissa without its leading one. Magnitudes beyond the
+   * range, including infinity, are clipped, magnitudes below it are written as 0.
+   * NaN is written as 0, because a clipped value would pretend a measurement.
+   * @param value The value.
+   * @param format The numbers of bits used for the exponent and the mantissa.
+   */
+  void writeFloat(float value, ReducedFloat format = ReducedFloat())
+  {
+    const int bias = 1 << (format.exponentBits - 1);
+    const int maxExponent = (1 << format.exponentBits) - 1;
+    const uint32_t mantissaSteps = 1u << format.mantissaBits;
+    int exponent = 0;
+    uint32_t mantissa = 0;
+    if(std::isinf(value))
+    {
+      exponent = maxExponent;
+      mantissa = mantissaSteps - 1;
+    }
+    else if(value != 0.f && !std::isnan(value))
+    {
+      const float fraction = std::frexp(std::abs(value), &exponent); // 0.5 <= fraction < 1
+      mantissa = static_cast<uint32_t>(std::lround((fraction * 2.f - 1.f) * static_cast<float>(mantissaSteps)));
+      if(mantissa == mantissaSteps)
+      {
+        mantissa = 0;
+        ++exponent;
+      }
+      exponent += bias;
+      if(exponent <= 0)
+        exponent = mantissa = 0;
+      else if(exponent > maxExponent)
+      {
+        exponent = maxExponent;
+        mantissa = mantissaSteps - 1;
+      }
+    }
+    writeBool(value < 0.f);
+    writeBits(static_cast<uint32_t>(exponent), format.exponentBits);
+    writeBits(mantissa, format.mantissaBits);
+  }
+
+  /**
+   * Writes the bits that are still buffered to memory.
+   * @return The number of bytes written (or counted) in total.
+   */
+  size_t finish()
+  {
+    if(data && bitsInBuffer)
+    {
+      *data++ = static_cast<uint8_t>(buffer);
+      buffer = 0;
+      numOfBits += 8 - bitsInBuffer;
+      bitsInBuffer = 0;
+    }
+    else
+      numOfBits = (numOfBits + 7) & ~size_t(7);
+    return numOfBits / 8;
+  }
+};
+
+class BitReader
+{
+private:
+  const uint8_t* data; /**< The memory that is read from. */
+  uint64_t buffer = 0; /**< The bits that were read from memory, but not returned yet. */
+  unsigned bitsInBuffer = 0; /**< The number of bits in the buffer. */
+
+public:
+  /**
+   * Constructor.
+   * @param data The memory that is read from.
+   */
+  explicit BitReader(const void* data) : data(reinterpret_cast<const uint8_t*>(data)) {}
+
+  /**
+   * Reads a value from the given number of bits.
+   * @param bits The number of bits to read (0..32).
+   * @return The value.
+   */
+  uint32_t readBits(unsigned bits)
+  {
+    ASSERT(bits <= 32);
+    for(; bitsInBuffer < bits; bitsInBuffer += 8)
+      buffer |= static_cast<uint64_t>(*data++) << bitsInBuffer;
+    const uint32_t value = static_cast<uint32_t>(buffer & ((uint64_t(1) << bits) - 1));
+    buffer >>= bits;
+    bitsInBuffer -= bits;
+    return value;
+  }
+
+  bool readBool()
+  {
+    return readBits(1) != 0;
+  }
+
+  /**
+   * Reads an unsigned value.
+   * @param max The largest value that can be represented.
+   * @return The value.
+   */
+  uint32_t readUnsigned(uint32_t max)
+  {
+    return readBits(bitsFor(max));
+  }
+
+  /**
+   * Reads a signed value.
+   * @param min The smallest value that can be represented.
+   * @param max The largest value that can be represented.
+   * @return The value.
+   */
+  int readSigned(int min, int max)
+  {
+    return static_cast<int>(readBits(bitsFor(static_cast<uint32_t>(max - min)))) + min;
+  }
+
+  /**
+   * Reads a quantized floating point value.
+   * @param min The smallest value that can be represented.
+   * @param max The largest value that can be represented.
+   * @param bits The number of bits used.
+   * @return The value.
+   */
+  float readQuantized(float min, float max, unsigned bits)
+  {
+    const uint32_t steps = static_cast<uint32_t>((uint64_t(1) << bits) - 1);
+    return min + static_cast<float>(readBits(bits)) * (max - min) / static_cast<float>(steps);
+  }
+
+  /**
+   * Reads a floating point value with reduced precision.
+   * @param format The numbers of bits used for the exponent and the mantissa.
+   * @return The value.
+   */
+  float readFloat(ReducedFloat format = ReducedFloat())
+  {
+    const bool negative = readBool();
+    const int exponent = static_cast<int>(readBits(format.exponentBits));
+    const uint32_t mantissa = readBits(format.mantissaBits);
+    if(!exponent)
+      return 0.f;
+    const float fraction = (1.f + static_cast<float>(mantissa) / static_cast<float>(1u << format.mantissaBits)) * 0.5f;
+    const float value = std::ldexp(fraction, exponent - (1 << (format.exponentBits - 1)));
+    return negative ? -value : value;
+  }
+};
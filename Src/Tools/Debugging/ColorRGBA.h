@@ -33,6 +33,9 @@ public:
 
   ColorRGBA operator*(float scale) const;
   ColorRGBA blend(const ColorRGBA& other) const;
+
+  bool operator==(const ColorRGBA& other) const {return r == other.r && g == other.g && b == other.b && a == other.a;}
+  bool operator!=(const ColorRGBA& other) const {return !(*this == other);}
 };
 
 In& operator>>(In& stream, ColorRGBA&);
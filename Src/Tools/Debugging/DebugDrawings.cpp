@@ -38,6 +38,7 @@ void DrawingManager::clear()
   strings.clear();
   drawingsById.clear();
   typesById.clear();
+  packedDrawings.clear();
 }
 
 const char* DrawingManager::getString(const std::string& string)
@@ -52,6 +53,40 @@ const char* DrawingManager::getString(const std::string& string)
   return i->second;
 }
 
+void DrawingManager::line(const char* name, float x1, float y1, float x2, float y2, float width, char penStyle, const ColorRGBA& penColor)
+{
+  const char id = getDrawingId(name);
+  PackedDrawing& packedDrawing = packedDrawings[id];
+  if(packedDrawing.full())
+    flush(id);
+  packedDrawing.addLine(x1, y1, x2, y2, width, penStyle, penColor);
+}
+
+void DrawingManager::dot(const char* name, int x, int y, const ColorRGBA& penColor, const ColorRGBA& brushColor)
+{
+  const char id = getDrawingId(name);
+  PackedDrawing& packedDrawing = packedDrawings[id];
+  if(packedDrawing.full())
+    flush(id);
+  packedDrawing.addDot(x, y, penColor, brushColor);
+}
+
+void DrawingManager::flush()
+{
+  for(auto& pair : packedDrawings)
+    flush(pair.first);
+}
+
+void DrawingManager::flush(char id)
+{
+  const auto i = packedDrawings.find(id);
+  if(i != packedDrawings.end() && !i->second.empty())
+  {
+    OUTPUT(idDebugDrawingPacked, bin, id << i->second);
+    i->second.clear();
+  }
+}
+
 In& operator>>(In& stream, DrawingManager& drawingManager)
 {
   // note that this operator appends the data read to the drawingManager
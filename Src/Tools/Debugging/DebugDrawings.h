@@ -8,6 +8,7 @@
 
 #include "Tools/Debugging/ColorRGBA.h"
 #include "Tools/Debugging/Debugging.h"
+#include "Tools/Debugging/PackedDrawing.h"
 #include "Tools/Math/BHMath.h"
 #include "Tools/Math/Covariance.h"
 #include "Tools/Math/Eigen.h"
@@ -60,6 +61,8 @@ private:
   std::unordered_map<char, const char*> drawingsById;
   std::unordered_map<char, const char*> typesById;
 
+  std::unordered_map<char, PackedDrawing> packedDrawings; /**< The lines and dots not sent yet per drawing id. */
+
   friend class ThreadFrame; /**< A thread is allowed to create the instance. */
   friend class RobotConsole;
   friend class DrawingManager3D;
@@ -82,7 +85,50 @@ public:
   const char* getDrawingName(char id) const;
   const char* getString(const std::string& string);
 
+  /**
+   * Adds a line to the packed lines and dots of a drawing.
+   * @param name The name of the drawing.
+   * @param x1 The x coordinate of the starting point.
+   * @param y1 The y coordinate of the starting point.
+   * @param x2 The x coordinate of the end point.
+   * @param y2 The y coordinate of the end point.
+   * @param width The width of the line.
+   * @param penStyle The pen style of the line (Drawings::PenStyle).
+   * @param penColor The color of the line.
+   */
+  void line(const char* name, float x1, float y1, float x2, float y2, float width, char penStyle, const ColorRGBA& penColor);
+
+  /**
+   * Adds a dot to the packed lines and dots of a drawing.
+   * @param name The name of the drawing.
+   * @param x The x coordinate of the center of the dot.
+   * @param y The y coordinate of the center of the dot.
+   * @param penColor The color of the border of the dot.
+   * @param brushColor The color of the dot.
+   */
+  void dot(const char* name, int x, int y, const ColorRGBA& penColor, const ColorRGBA& brushColor);
+
+  /**
+   * Sends the packed lines and dots of a drawing. This must happen before
+   * other shapes are sent for the drawing to keep the order of all shapes.
+   * @param name The name of the drawing.
+   */
+  void flush(const char* name)
+  {
+    if(!packedDrawings.empty())
+      flush(getDrawingId(name));
+  }
+
+  /** Sends the packed lines and dots of all drawings. Called at the end of each frame. */
+  void flush();
+
 private:
+  /**
+   * Sends the packed lines and dots of a drawing.
+   * @param id The id of the drawing.
+   */
+  void flush(char id);
+
   const char* getTypeName(char id) const;
 };
 
@@ -134,7 +180,7 @@ inline const char* DrawingManager::getTypeName(char id) const
  * and executes the following block if the drawing is requested.
  */
 #define DEBUG_DRAWING(id, type) \
-  if(Global::getDrawingManager().addDrawingId(id, type), _debugRequestActive("debug drawing:" id))
+  if(_DEBUG_REQUEST_CACHE; Global::getDrawingManager().addDrawingId(id, type), _debugRequestActive("debug drawing:" id, _debugRequestCache))
 
 /**
  * A macro that declares
@@ -172,6 +218,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
+      Global::getDrawingManager().flush(id); \
       OUTPUT(idDebugDrawing, bin, \
              static_cast<char>(Drawings::circle) << \
              Global::getDrawingManager().getDrawingId(id) << \
@@ -201,6 +248,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
+      Global::getDrawingManager().flush(id); \
       OUTPUT(idDebugDrawing, bin, \
              static_cast<char>(Drawings::arc) << \
              Global::getDrawingManager().getDrawingId(id) << \
@@ -230,6 +278,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
+      Global::getDrawingManager().flush(id); \
       OUTPUT(idDebugDrawing, bin, \
              static_cast<char>(Drawings::ellipse) << \
              Global::getDrawingManager().getDrawingId(id) << \
@@ -256,6 +305,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
+      Global::getDrawingManager().flush(id); \
       OUTPUT(idDebugDrawing, bin, \
              static_cast<char>(Drawings::rectangle) << \
              Global::getDrawingManager().getDrawingId(id) << \
@@ -285,6 +335,7 @@ inline const char* DrawingManager::getTypeName(char id) const
       OutTextMemory _stream(static_cast<int>(numberOfPoints) * 12); \
       for(int _i = 0; _i < static_cast<int>(numberOfPoints); ++_i) \
         _stream << static_cast<int>(points[_i].x()) << static_cast<int>(points[_i].y()); \
+      Global::getDrawingManager().flush(id); \
       OUTPUT(idDebugDrawing, bin, \
              static_cast<char>(Drawings::polygon) << \
              Global::getDrawingManager().getDrawingId(id) << \
@@ -308,11 +359,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::dot) << \
-             Global::getDrawingManager().getDrawingId(id) << \
-             static_cast<int>(x) << static_cast<int>(y) << ColorRGBA(penColor) << ColorRGBA(brushColor) \
-            ); \
+      Global::getDrawingManager().dot(id, static_cast<int>(x), static_cast<int>(y), ColorRGBA(penColor), ColorRGBA(brushColor)); \
     } \
   while(false)
 
@@ -327,12 +374,8 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::dot) << \
-             Global::getDrawingManager().getDrawingId(id) << \
-             static_cast<int>((xy).x()) << static_cast<int>((xy).y()) << \
-             ColorRGBA(penColor) << ColorRGBA(brushColor) \
-            ); \
+      Global::getDrawingManager().dot(id, static_cast<int>((xy).x()), static_cast<int>((xy).y()), \
+                                      ColorRGBA(penColor), ColorRGBA(brushColor)); \
     } \
   while(false)
 
@@ -348,6 +391,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
+      Global::getDrawingManager().flush(id); \
       OUTPUT(idDebugDrawing, bin, \
              static_cast<char>(Drawings::dotMedium) << \
              Global::getDrawingManager().getDrawingId(id) << \
@@ -368,6 +412,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
+      Global::getDrawingManager().flush(id); \
       OUTPUT(idDebugDrawing, bin, \
              static_cast<char>(Drawings::dotLarge) << \
              Global::getDrawingManager().getDrawingId(id) << \
@@ -391,13 +436,9 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
-      OUTPUT(idDebugDrawing, bin, \
-             static_cast<char>(Drawings::line) << \
-             Global::getDrawingManager().getDrawingId(id) << \
-             static_cast<float>(x1) << static_cast<float>(y1) << \
-             static_cast<float>(x2) << static_cast<float>(y2) << \
-             static_cast<float>(penWidth) << static_cast<char>(penStyle) << ColorRGBA(penColor) \
-            ); \
+      Global::getDrawingManager().line(id, static_cast<float>(x1), static_cast<float>(y1), \
+                                       static_cast<float>(x2), static_cast<float>(y2), \
+                                       static_cast<float>(penWidth), static_cast<char>(penStyle), ColorRGBA(penColor)); \
     } \
   while(false)
 
@@ -423,6 +464,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
+      Global::getDrawingManager().flush(id); \
       OUTPUT(idDebugDrawing, bin, \
              static_cast<char>(Drawings::arrow) << \
              Global::getDrawingManager().getDrawingId(id) << \
@@ -527,6 +569,7 @@ inline const char* DrawingManager::getTypeName(char id) const
     { \
       OutTextRawMemory _stream; \
       _stream << txt; \
+      Global::getDrawingManager().flush(id); \
       OUTPUT(idDebugDrawing, bin, \
              static_cast<char>(Drawings::text) << \
              Global::getDrawingManager().getDrawingId(id) << \
@@ -545,6 +588,7 @@ inline const char* DrawingManager::getTypeName(char id) const
     { \
       OutTextRawMemory _stream(1024); \
       _stream << action; \
+      Global::getDrawingManager().flush(id); \
       OUTPUT(idDebugDrawing, bin, \
              static_cast<char>(Drawings::spot) << \
              Global::getDrawingManager().getDrawingId(id) << \
@@ -568,6 +612,7 @@ inline const char* DrawingManager::getTypeName(char id) const
     { \
       OutTextRawMemory _stream(1024); \
       _stream << text; \
+      Global::getDrawingManager().flush(id); \
       OUTPUT(idDebugDrawing, bin, \
              static_cast<char>(Drawings::tip) << \
              Global::getDrawingManager().getDrawingId(id) << \
@@ -585,6 +630,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
+      Global::getDrawingManager().flush(id); \
       OUTPUT(idDebugDrawing, bin, \
              static_cast<char>(Drawings::thread) << \
              Global::getDrawingManager().getDrawingId(id) << \
@@ -604,6 +650,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
+      Global::getDrawingManager().flush(id); \
       OUTPUT(idDebugDrawing, bin, \
              static_cast<char>(Drawings::origin) << \
              Global::getDrawingManager().getDrawingId(id) << \
@@ -627,6 +674,7 @@ inline const char* DrawingManager::getTypeName(char id) const
   do \
     COMPLEX_DRAWING(id) \
     { \
+      Global::getDrawingManager().flush(id); \
       OUTPUT(idDebugDrawing, bin, \
              static_cast<char>(Drawings::robot) << \
              Global::getDrawingManager().getDrawingId(id) << \
@@ -3,7 +3,6 @@
  */
 
 #pragma once
-#ifndef TARGET_TOOL
 
 #include "Tools/Debugging/DebugDrawings.h"
 #include "Tools/Math/Eigen.h"
@@ -39,7 +38,6 @@ namespace Drawings3D
  * singleton drawing manager class.
  */
 class DrawingManager3D : public DrawingManager {};
-#endif
 
 #if !defined TARGET_TOOL && (!defined TARGET_ROBOT || !defined NDEBUG)
 /**
@@ -50,7 +48,7 @@ class DrawingManager3D : public DrawingManager {};
  * and executes the following block if the drawing is requested.
  */
 #define DEBUG_DRAWING3D(id, type) \
-  if(Global::getDrawingManager3D().addDrawingId(id, type), _debugRequestActive("debug drawing 3d:" id))
+  if(_DEBUG_REQUEST_CACHE; Global::getDrawingManager3D().addDrawingId(id, type), _debugRequestActive("debug drawing 3d:" id, _debugRequestCache))
 
 /**
  * A macro that declares.
@@ -13,7 +13,10 @@
 #include "DebugRequest.h"
 #include "Platform/BHAssert.h"
 
-DebugRequestTable::DebugRequestTable()
+std::atomic<unsigned> DebugRequestTable::lastGeneration(0);
+
+DebugRequestTable::DebugRequestTable() :
+  generation(++lastGeneration)
 {
   enabled.reserve(10000);
   fastIndex.reserve(10000);
@@ -40,6 +43,7 @@ void DebugRequestTable::addRequest(const DebugRequest& debugRequest)
       slowIndex[debugRequest.name] = enabled.size();
       enabled.push_back(debugRequest.enable ? 1 : 0);
     }
+    changed();
   }
 }
 
@@ -63,6 +67,7 @@ void DebugRequestTable::disable(const char* name)
 {
   ASSERT(fastIndex.find(name) != fastIndex.end());
   enabled[fastIndex[name]] = 0;
+  changed();
 }
 
 bool DebugRequestTable::notYetPolled(const char* name)
@@ -81,6 +86,7 @@ void DebugRequestTable::clear()
   fastIndex.clear();
   slowIndex.clear();
   enabled.clear();
+  changed();
 }
 
 void DebugRequestTable::print(const char* message)
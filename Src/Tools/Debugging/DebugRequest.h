@@ -11,6 +11,7 @@
 #pragma once
 
 #include "Tools/Streams/AutoStreamable.h"
+#include <atomic>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -37,11 +38,23 @@ inline DebugRequest::DebugRequest(const std::string& name, bool enable)
  *
  * A singleton class that maintains the table of currently active debug requests.
  * It provides a fast access based on character pointers and a slower one based
- * on strings.
+ * on strings. The fastest access is through a cache that each place checking a
+ * request keeps. It remains valid until any request is changed.
  */
 class DebugRequestTable
 {
+public:
+  /** The state of a request cached where it is checked. */
+  struct Cache
+  {
+    const char* name = nullptr; /**< The name of the request the state was cached for. */
+    unsigned generation = 0; /**< The generation of the table when the state was cached. */
+    bool active = false; /**< Was the request active? */
+  };
+
 private:
+  static std::atomic<unsigned> lastGeneration; /**< The generation assigned last. It is shared by all tables. */
+  unsigned generation; /**< Changes whenever the state of a request changes. It is never 0. */
   std::vector<char> enabled; /**< Are requests enabled or disabled? */
   std::unordered_map<const char*, size_t> fastIndex; /**< Maps char pointers to entries of vector "enabled". */
   std::unordered_map<std::string, size_t> slowIndex; /**< Maps strings to entries of vector "enabled". */
@@ -61,6 +74,9 @@ private:
    */
   bool isActiveSlow(const char* name);
 
+  /** Invalidates all caches by switching to a new generation. */
+  void changed() {generation = ++lastGeneration;}
+
 public:
   int pollCounter = 0; /**< How many frames is polling still active? */
 
@@ -80,6 +96,15 @@ public:
    */
   bool isActive(const char* name);
 
+  /**
+   * Is a debug request active? The state is looked up in the table only if
+   * it is not in the cache.
+   * @param name The name of the request.
+   * @param cache The cache of the place where the request is checked.
+   * @return Is it active?
+   */
+  bool isActive(const char* name, Cache& cache);
+
   /**
    * Disable a debug request.
    * Note: isActive must have been called before for this request.
@@ -114,3 +139,14 @@ inline bool DebugRequestTable::isActive(const char* name)
   std::unordered_map<const char*, size_t>::const_iterator i = fastIndex.find(name);
   return i != fastIndex.end() ? enabled[i->second] != 0 : isActiveSlow(name);
 }
+
+inline bool DebugRequestTable::isActive(const char* name, Cache& cache)
+{
+  if(cache.generation != generation || cache.name != name)
+  {
+    cache.name = name;
+    cache.generation = generation;
+    cache.active = isActive(name);
+  }
+  return cache.active;
+}
@@ -118,15 +118,22 @@
 /**
  * Register debug request if required and check whether it is active.
  * @param id The name of the debug request.
+ * @param cache The cache of the place where the request is checked.
  * @return Is it active?
  */
-inline bool _debugRequestActive(const char* id)
+inline bool _debugRequestActive(const char* id, DebugRequestTable::Cache& cache)
 {
   if(Global::getDebugRequestTable().pollCounter && Global::getDebugRequestTable().notYetPolled(id))
     OUTPUT(idDebugResponse, text, id << Global::getDebugRequestTable().isActive(id));
-  return Global::getDebugRequestTable().isActive(id);
+  return Global::getDebugRequestTable().isActive(id, cache);
 }
 
+/**
+ * Declares the cache for a debug request check, which is a statement in the
+ * condition of an if statement. Each place has its own cache per thread.
+ */
+#define _DEBUG_REQUEST_CACHE static thread_local DebugRequestTable::Cache _debugRequestCache
+
 /**
  * Declares a debugging switch. This is only necessary in case, where the actual switch
  * is not always reached in each execution cycle.
@@ -143,26 +150,26 @@ inline bool _debugRequestActive(const char* id)
  * @param id The id of the debugging switch
  */
 #define DEBUG_RESPONSE(id) \
-  if(_debugRequestActive(id))
+  if(_DEBUG_REQUEST_CACHE; _debugRequestActive(id, _debugRequestCache))
 
 /**
  * A debugging switch, allowing the non-recurring execution of the following block.
  * @param id The id of the debugging switch
  */
 #define DEBUG_RESPONSE_ONCE(id) \
-  if(_debugRequestActive(id) && (Global::getDebugRequestTable().disable(id), true))
+  if(_DEBUG_REQUEST_CACHE; _debugRequestActive(id, _debugRequestCache) && (Global::getDebugRequestTable().disable(id), true))
 
 /**
  * A debugging switch, allowing the enabling or disabling of the block that follows.
  * @param id The id of the debugging switch
  */
 #define DEBUG_RESPONSE_NOT(id) \
-  if(!_debugRequestActive(id))
+  if(_DEBUG_REQUEST_CACHE; !_debugRequestActive(id, _debugRequestCache))
 
 /**
  * Execute following block if debug request is active.
  * The request is not pollable.
  */
 #define DECLARED_DEBUG_RESPONSE(id) \
-  if(Global::getDebugRequestTable().isActive(id))
+  if(_DEBUG_REQUEST_CACHE; Global::getDebugRequestTable().isActive(id, _debugRequestCache))
 #endif // TARGET_TOOL
@@ -0,0 +1,165 @@
+/**
+ * @file PackedDrawing.cpp
+ *
+ * The file implements a buffer that collects the lines and dots of a debug
+ * drawing in a compact format.
+ */
+
+#include "PackedDrawing.h"
+#include "Platform/BHAssert.h"
+#include <algorithm>
+#include <cmath>
+
+void PackedDrawing::addLine(float x1, float y1, float x2, float y2, float width, char penStyle, const ColorRGBA& penColor)
+{
+  ASSERT(!full());
+  const int qx1 = quantize(x1);
+  const int qy1 = quantize(y1);
+  data.push_back(static_cast<unsigned char>(Shape::line));
+  data.push_back(static_cast<unsigned char>(penStyle));
+  data.push_back(getColorIndex(penColor));
+  writeUnsigned(static_cast<unsigned>(std::max(0, quantize(width))));
+  writeSigned(qx1 - lastX);
+  writeSigned(qy1 - lastY);
+  writeSigned(quantize(x2) - qx1);
+  writeSigned(quantize(y2) - qy1);
+  lastX = qx1;
+  lastY = qy1;
+  ++numOfElements;
+}
+
+void PackedDrawing::addDot(int x, int y, const ColorRGBA& penColor, const ColorRGBA& brushColor)
+{
+  ASSERT(!full());
+  const int qx = quantize(static_cast<float>(x));
+  const int qy = quantize(static_cast<float>(y));
+  data.push_back(static_cast<unsigned char>(Shape::dot));
+  data.push_back(getColorIndex(penColor));
+  data.push_back(getColorIndex(brushColor));
+  writeSigned(qx - lastX);
+  writeSigned(qy - lastY);
+  lastX = qx;
+  lastY = qy;
+  ++numOfElements;
+}
+
+void PackedDrawing::clear()
+{
+  palette.clear();
+  data.clear();
+  numOfElements = 0;
+  lastX = lastY = 0;
+}
+
+void PackedDrawing::getElements(std::vector<Element>& elements) const
+{
+  size_t pos = 0;
+  const auto readUnsigned = [&]
+  {
+    unsigned value = 0;
+    for(int shift = 0; pos < data.size(); shift += 7)
+    {
+      const unsigned char byte = data[pos++];
+      value |= static_cast<unsigned>(byte & 0x7f) << shift;
+      if(!(byte & 0x80))
+        break;
+    }
+    return value;
+  };
+  const auto readSigned = [&]
+  {
+    const unsigned value = readUnsigned();
+    return static_cast<int>(value >> 1) ^ -static_cast<int>(value & 1);
+  };
+  const auto readColor = [&]
+  {
+    const unsigned char index = pos < data.size() ? data[pos++] : 0;
+    return index < palette.size() ? palette[index] : ColorRGBA();
+  };
+
+  elements.clear();
+  elements.reserve(numOfElements);
+  int x = 0;
+  int y = 0;
+  for(unsigned i = 0; i < numOfElements && pos < data.size(); ++i)
+  {
+    Element element;
+    element.shape = static_cast<Shape>(data[pos++]);
+    if(element.shape == Shape::line)
+    {
+      element.penStyle = pos < data.size() ? static_cast<char>(data[pos++]) : 0;
+      element.penColor = readColor();
+      element.width = static_cast<float>(readUnsigned()) / scale;
+      x += readSigned();
+      y += readSigned();
+      element.x2 = static_cast<float>(x + readSigned()) / scale;
+      element.y2 = static_cast<float>(y + readSigned()) / scale;
+    }
+    else
+    {
+      element.penColor = readColor();
+      element.brushColor = readColor();
+      x += readSigned();
+      y += readSigned();
+    }
+    element.x1 = static_cast<float>(x) / scale;
+    element.y1 = static_cast<float>(y) / scale;
+    elements.push_back(element);
+  }
+}
+
+unsigned char PackedDrawing::getColorIndex(const ColorRGBA& color)
+{
+  const auto i = std::find(palette.begin(), palette.end(), color);
+  if(i != palette.end())
+    return static_cast<unsigned char>(i - palette.begin());
+  ASSERT(palette.size() < maxPaletteSize);
+  palette.push_back(color);
+  return static_cast<unsigned char>(palette.size() - 1);
+}
+
+void PackedDrawing::writeUnsigned(unsigned value)
+{
+  while(value >= 0x80)
+  {
+    data.push_back(static_cast<unsigned char>(value | 0x80));
+    value >>= 7;
+  }
+  data.push_back(static_cast<unsigned char>(value));
+}
+
+int PackedDrawing::quantize(float value)
+{
+  // Differences of clipped values still fit into an int.
+  constexpr float limit = static_cast<float>(1 << 29);
+  if(std::isnan(value))
+    return 0;
+  return static_cast<int>(std::round(std::max(-limit, std::min(value * scale, limit))));
+}
+
+In& operator>>(In& stream, PackedDrawing& packedDrawing)
+{
+  packedDrawing.clear();
+  unsigned char paletteSize;
+  stream >> paletteSize;
+  packedDrawing.palette.resize(paletteSize);
+  for(ColorRGBA& color : packedDrawing.palette)
+    stream >> color;
+  unsigned size;
+  stream >> packedDrawing.numOfElements >> size;
+  packedDrawing.data.resize(size);
+  if(size)
+    stream.read(packedDrawing.data.data(), size);
+  return stream;
+}
+
+Out& operator<<(Out& stream, const PackedDrawing& packedDrawing)
+{
+  stream << static_cast<unsigned char>(packedDrawing.palette.size());
+  for(const ColorRGBA& color : packedDrawing.palette)
+    stream << color;
+  stream << packedDrawing.numOfElements << static_cast<unsigned>(packedDrawing.data.size());
+  if(!packedDrawing.data.empty())
+    stream.write(packedDrawing.data.data(), packedDrawing.data.size());
+  return stream;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file PackedDrawing.h
+ *
+ * The file declares a buffer that collects the lines and dots of a debug
+ * drawing in a compact format. Coordinates and widths are quantized to 1/16
+ * and stored as variable-length differences to the previous element of the
+ * same drawing. Colors are replaced by indices into a palette. All lines and
+ * dots a drawing contains in a frame are sent as a single message.
+ */
+
+#pragma once
+
+#include "Tools/Debugging/ColorRGBA.h"
+#include <vector>
+
+class PackedDrawing
+{
+public:
+  /** The shapes a packed drawing can contain. */
+  enum class Shape : unsigned char
+  {
+    line,
+    dot
+  };
+
+  /** A shape read from a packed drawing. */
+  struct Element
+  {
+    Shape shape = Shape::line;
+    float x1 = 0.f; /**< The x coordinate of the start of a line or of the center of a dot. */
+    float y1 = 0.f; /**< The y coordinate of the start of a line or of the center of a dot. */
+    float x2 = 0.f; /**< The x coordinate of the end of a line. */
+    float y2 = 0.f; /**< The y coordinate of the end of a line. */
+    float width = 0.f; /**< The width of a line. */
+    char penStyle = 0; /**< The pen style of a line (Drawings::PenStyle). */
+    ColorRGBA penColor;
+    ColorRGBA brushColor; /**< The color of a dot. */
+  };
+
+private:
+  static constexpr float scale = 16.f; /**< Coordinates and widths are stored in multiples of 1 / scale. */
+  static constexpr size_t maxPaletteSize = 255; /**< Palette indices are stored in a byte. */
+
+  std::vector<ColorRGBA> palette; /**< The colors used by the elements. */
+  std::vector<unsigned char> data; /**< The encoded elements. */
+  unsigned numOfElements = 0; /**< The number of elements encoded. */
+  int lastX = 0; /**< The quantized x coordinate of the previous element. */
+  int lastY = 0; /**< The quantized y coordinate of the previous element. */
+
+public:
+  /**
+   * Adds a line.
+   * @param x1 The x coordinate of the starting point.
+   * @param y1 The y coordinate of the starting point.
+   * @param x2 The x coordinate of the end point.
+   * @param y2 The y coordinate of the end point.
+   * @param width The width of the line.
+   * @param penStyle The pen style of the line (Drawings::PenStyle).
+   * @param penColor The color of the line.
+   */
+  void addLine(float x1, float y1, float x2, float y2, float width, char penStyle, const ColorRGBA& penColor);
+
+  /**
+   * Adds a dot.
+   * @param x The x coordinate of the center of the dot.
+   * @param y The y coordinate of the center of the dot.
+   * @param penColor The color of the border of the dot.
+   * @param brushColor The color of the dot.
+   */
+  void addDot(int x, int y, const ColorRGBA& penColor, const ColorRGBA& brushColor);
+
+  /** Removes all elements, but keeps the memory allocated. */
+  void clear();
+
+  /** Does the drawing contain no elements? */
+  bool empty() const {return numOfElements == 0;}
+
+  /** Must the drawing be sent and cleared before the next element can be added? */
+  bool full() const {return palette.size() > maxPaletteSize - 2;}
+
+  /**
+   * Decodes the elements of the drawing.
+   * @param elements The elements in the order in which they were added are stored here.
+   */
+  void getElements(std::vector<Element>& elements) const;
+
+private:
+  /**
+   * Returns the index of a color in the palette. The color is added if it is missing.
+   * @param color The color.
+   * @return The index of the color.
+   */
+  unsigned char getColorIndex(const ColorRGBA& color);
+
+  /** Appends an unsigned number using 7 bits per byte. */
+  void writeUnsigned(unsigned value);
+
+  /** Appends a signed number, mapping small magnitudes to small unsigned numbers. */
+  void writeSigned(int value) {writeUnsigned((static_cast<unsigned>(value) << 1) ^ static_cast<unsigned>(value >> 31));}
+
+  /** Quantizes a coordinate or width. Very large magnitudes are clipped. */
+  static int quantize(float value);
+
+  friend In& operator>>(In& stream, PackedDrawing& packedDrawing);
+  friend Out& operator<<(Out& stream, const PackedDrawing& packedDrawing);
+};
+
+In& operator>>(In& stream, PackedDrawing& packedDrawing);
+Out& operator<<(Out& stream, const PackedDrawing& packedDrawing);
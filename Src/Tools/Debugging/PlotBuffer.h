@@ -0,0 +1,148 @@
+/**
+ * @file PlotBuffer.h
+ *
+ * The file declares a ring buffer for the values of a plot. In addition to
+ * the values, it maintains the minimum and maximum of aligned blocks of 16,
+ * 256, and 4096 values. Therefore, the extremes of a range of values can be
+ * determined without visiting all of them, which allows drawing long plots
+ * with one line per pixel column rather than per value.
+ */
+
+#pragma once
+
+#include "Platform/BHAssert.h"
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+class PlotBuffer
+{
+public:
+  /** The minimum and maximum of a range of values. */
+  struct MinMax
+  {
+    float min;
+    float max;
+  };
+
+private:
+  static constexpr size_t numOfLevels = 3; /**< The number of levels of blocks. */
+  static constexpr size_t blockShift = 4; /**< Each level combines 2^blockShift blocks of the level below. */
+  static constexpr size_t chunkSize = size_t(1) << (numOfLevels * blockShift); /**< The size of the largest blocks. */
+
+  std::vector<float> values; /**< The ring buffer of values. Its size is a multiple of chunkSize. */
+  std::vector<MinMax> levels[numOfLevels]; /**< The extremes of the blocks of each level. */
+  size_t numOfValues = 0; /**< The number of values added since the last clear. */
+  size_t requestedCapacity = 0; /**< The number of values that should be kept. */
+
+public:
+  /**
+   * Constructor.
+   * @param capacity The number of values to keep.
+   */
+  PlotBuffer(size_t capacity = 0) {setCapacity(capacity);}
+
+  /**
+   * Changes the number of values kept. The newest values are preserved.
+   * @param capacity The number of values to keep.
+   */
+  void setCapacity(size_t capacity)
+  {
+    if(capacity == requestedCapacity)
+      return;
+    PlotBuffer buffer;
+    buffer.requestedCapacity = capacity;
+    buffer.values.resize((capacity + chunkSize - 1) / chunkSize * chunkSize);
+    for(size_t i = 0; i < numOfLevels; ++i)
+      buffer.levels[i].resize(buffer.values.size() >> ((i + 1) * blockShift));
+    for(size_t i = std::min(size(), capacity); i > 0;)
+      buffer.push_front((*this)[--i]);
+    *this = std::move(buffer);
+  }
+
+  /** Returns the number of values kept. */
+  size_t capacity() const {return requestedCapacity;}
+
+  /** Returns the number of values currently available. */
+  size_t size() const {return std::min(numOfValues, requestedCapacity);}
+
+  /** Returns whether no values are available. */
+  bool empty() const {return size() == 0;}
+
+  /** Removes all values. */
+  void clear() {numOfValues = 0;}
+
+  /**
+   * Adds a value. If the buffer is full, the oldest value is overwritten.
+   * @param value The new value.
+   */
+  void push_front(float value)
+  {
+    if(values.empty())
+      return;
+    values[numOfValues % values.size()] = value;
+    for(size_t i = 0; i < numOfLevels; ++i)
+    {
+      const size_t shift = (i + 1) * blockShift;
+      MinMax& block = levels[i][(numOfValues >> shift) % levels[i].size()];
+      if(numOfValues & ((size_t(1) << shift) - 1))
+      {
+        block.min = std::min(block.min, value);
+        block.max = std::max(block.max, value);
+      }
+      else
+        block = {value, value};
+    }
+    ++numOfValues;
+  }
+
+  /**
+   * Accesses a value.
+   * @param index The age of the value. 0 is the newest one.
+   * @return The value.
+   */
+  float operator[](size_t index) const
+  {
+    ASSERT(index < size());
+    return values[(numOfValues - 1 - index) % values.size()];
+  }
+
+  /**
+   * Determines the minimum and maximum of a range of values.
+   * @param begin The age of the newest value in the range.
+   * @param end The age after the oldest value in the range.
+   * @return The extremes of the range. Must not be empty.
+   */
+  MinMax getMinMax(size_t begin, size_t end) const
+  {
+    ASSERT(begin < end && end <= size());
+
+    // Ages are converted to positions in the order the values were added.
+    size_t first = numOfValues - end;
+    const size_t last = numOfValues - begin;
+    MinMax result = {values[first % values.size()], values[first % values.size()]};
+    while(first < last)
+    {
+      // Use the largest block that starts here and does not exceed the range.
+      size_t level = numOfLevels;
+      while(level > 0 && ((first & ((size_t(1) << (level * blockShift)) - 1))
+                          || first + (size_t(1) << (level * blockShift)) > last))
+        --level;
+      if(level)
+      {
+        const MinMax& block = levels[level - 1][(first >> (level * blockShift)) % levels[level - 1].size()];
+        result.min = std::min(result.min, block.min);
+        result.max = std::max(result.max, block.max);
+        first += size_t(1) << (level * blockShift);
+      }
+      else
+      {
+        const float value = values[first++ % values.size()];
+        result.min = std::min(result.min, value);
+        result.max = std::max(result.max, value);
+      }
+    }
+    return result;
+  }
+};
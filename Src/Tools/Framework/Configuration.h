@@ -50,6 +50,7 @@ STREAMABLE(Configuration,
 
     (std::string) name,
     (int)(0) priority,
+    (int)(-1) realTimeCore, /**< The core the thread is pinned to in real-time mode on the robot. -1 deactivates the real-time mode. */
     (unsigned)(0) debugReceiverSize, /**< The maximum size of the queue in Bytes. */
     (unsigned)(0) debugSenderSize, /**< The maximum size of the queue in Bytes. */
     (unsigned)(0) debugSenderInfrastructureSize,
@@ -7,6 +7,7 @@
  */
 
 #include "ModuleContainer.h"
+#include "Platform/Memory.h"
 #include "Platform/SystemCall.h"
 #include "Platform/Time.h"
 #include "Threads/Debug.h"
@@ -21,6 +22,7 @@ thread_local std::list<std::function<bool(InMessage& message)>> ModuleContainer:
 ModuleContainer::ModuleContainer(const Configuration& config, const std::size_t index, Logger* logger) :
   name(config()[index].name),
   priority(config()[index].priority),
+  realTimeCore(config()[index].realTimeCore),
   moduleGraphRunner(config().size()),
   logger(logger)
 {
@@ -75,6 +77,16 @@ void ModuleContainer::init()
 {
   BH_TRACE_INIT(getName().c_str());
 
+  // Pin the thread to its core and lock the memory of the process in real-time mode
+  if(realTimeCore >= 0 && SystemCall::getMode() == SystemCall::physicalRobot)
+  {
+    if(!Thread::pinCurrentThread(realTimeCore))
+      OUTPUT_WARNING(getName() << ": Could not pin thread to core " << realTimeCore);
+    if(!Memory::lockAndPrefault(realTimeStackSize))
+      OUTPUT_WARNING(getName() << ": Could not lock memory");
+    realTime = true;
+  }
+
   // Prepare first frame
   numberOfMessages = debugSender->getNumberOfMessages();
   OUTPUT(idFrameBegin, bin, getName());
@@ -91,10 +103,25 @@ bool ModuleContainer::main()
     Global::getTimingManager().signalThreadStart();
     Global::getAnnotationManager().signalThreadStart();
 
+    // Heap allocations are counted during module execution in real-time mode
+    if(realTime)
+      Memory::monitorAllocations(true);
     executionUnit->beforeModules();
     STOPWATCH("AllModules") moduleGraphRunner.execute();
     executionUnit->afterModules();
+    if(realTime)
+    {
+      Memory::monitorAllocations(false);
+      allocationsSinceReport += Memory::getMonitoredAllocations();
+      if(allocationsSinceReport && Time::getTimeSince(timeWhenAllocationsReported) >= 1000)
+      {
+        OUTPUT_WARNING(getName() << ": " << allocationsSinceReport << " heap allocations while executing modules");
+        allocationsSinceReport = 0;
+        timeWhenAllocationsReported = Time::getCurrentSystemTime();
+      }
+    }
 
+    Global::getDrawingManager().flush();
     DEBUG_RESPONSE_ONCE("automated requests:DrawingManager") OUTPUT(idDrawingManager, bin, Global::getDrawingManager());
     DEBUG_RESPONSE_ONCE("automated requests:DrawingManager3D") OUTPUT(idDrawingManager3D, bin, Global::getDrawingManager3D());
 
@@ -25,6 +25,8 @@ struct Logger;
 class ModuleContainer : public ThreadFrame
 {
 private:
+  static constexpr size_t realTimeStackSize = 512 * 1024; /**< The size of the stack that is pre-faulted in real-time mode. */
+
   static thread_local std::list<std::function<bool(InMessage& message)>> messageHandlers; /**< A list of all MessageHandlers of this thread. */
 
   // Lists, since Sender.receiver would become invalid when resizing a vector.
@@ -33,6 +35,10 @@ private:
 
   const std::string name; /**< The name of this thread. */
   const int priority; /**< The priority of this thread. */
+  const int realTimeCore; /**< The core this thread is pinned to in real-time mode or -1 if the mode is off. */
+  bool realTime = false; /**< Is this thread running in real-time mode? */
+  unsigned allocationsSinceReport = 0; /**< The number of heap allocations during module execution since they were reported the last time. */
+  unsigned timeWhenAllocationsReported = 0; /**< When were heap allocations reported the last time? */
 
   FrameExecutionUnit* executionUnit = nullptr; /**< The thread specific code. */
   ModuleGraphRunner moduleGraphRunner; /**< The solution manager handles the execution of modules. */
@@ -73,6 +73,16 @@ extern "C" DLL_EXPORT SimRobot::Module* createModule(SimRobot::Application& simR
   return new ConsoleRoboCupCtrl(simRobot);
 }
 
+void Robot::startRendering()
+{
+  static_cast<LocalRobot*>(robotThread)->startRendering();
+}
+
+void Robot::join()
+{
+  static_cast<LocalRobot*>(robotThread)->join();
+}
+
 void Robot::update()
 {
   robotThread->update();
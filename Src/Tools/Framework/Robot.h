@@ -44,6 +44,16 @@ public:
   const std::string& getName() const { return name; }
 
 #ifdef TARGET_SIM
+  /**
+   * The function starts rendering the camera images if an image of this robot is due.
+   */
+  void startRendering();
+
+  /**
+   * The function waits until the robot has processed the data of the previous update.
+   */
+  void join();
+
   /**
    * The function updates all sensors and sends motor commands to SimRobot.
    */
@@ -506,3 +506,33 @@ void responseX16Y16RUsingSSE3(const CNSResponse* __restrict srcPixel, int srcOfs
   //cns_copyAccumulator ((unsigned short*) responseBin, (unsigned short*) accPixelCopy, 16*16);
   scaleOffsetUsingSSE(accPixelCopy, static_cast<signed short*>(responseBin), 16 * 16, contour.mapping.rawBin2FinalBinScale, contour.mapping.rawBin2FinalBinOffset);
 }
+
+void responseX32Y16RUsingSSE3(const CNSResponse* __restrict srcPixel, int srcOfs,
+                              signed short* __restrict responseBin, const CodedContour& contour)
+{
+  srcOfs /= sizeof(CNSResponse);
+  assert(aligned16(responseBin));
+  alignas(16) unsigned short accPixelCopy[32 * 16];
+  cns_zeroAccumulator(accPixelCopy, 32 * 16);
+
+  // Go through all contour pixels
+  for(CodedContour::const_iterator ccp = contour.begin(); ccp != contour.end(); ccp++)
+  {
+    CodedContourPoint ccpI = *ccp;
+    __m128i cosSinVal  = _mm_set1_epi16(nOfCCP(ccpI));  // put the (nx,ny) normal vector into every component
+    const CNSResponse* srcRun = srcPixel + xOfCCP(ccpI) + srcOfs * yOfCCP(ccpI);
+    __m128i cosPSinVal = _mm_maddubs_epi16(cns_const128V, cosSinVal);
+
+    // Each line consists of four independent chunks, which is enough to keep the pipeline busy
+    // without interleaving the instructions manually as in responseX16Y16RUsingSSE3.
+    // The left and the right half are accumulated in separate 16*16 blocks.
+    __m128i* acc = reinterpret_cast<__m128i*>(accPixelCopy);
+    for(int y = 0; y < 16; ++y, srcRun += srcOfs, acc += 2)
+    {
+      cns_reponseX16YRUsingSSE3(srcRun, cosSinVal, cosPSinVal, acc);
+      cns_reponseX16YRUsingSSE3(srcRun + 16, cosSinVal, cosPSinVal, acc + 32);
+    }
+  }
+
+  scaleOffsetUsingSSE(accPixelCopy, static_cast<signed short*>(responseBin), 32 * 16, contour.mapping.rawBin2FinalBinScale, contour.mapping.rawBin2FinalBinOffset);
+}
@@ -78,6 +78,15 @@ void responseX16Y16RUsingSSE3(const CNSResponse* srcPixel, int srcOfs, signed sh
  */
 void responseX8Y8RUsingSSE3(const CNSResponse* srcPixel, int srcOfs, signed short* responseBin, const CodedContour& contour);
 
+//! 32*16 block variant of \c responseX16Y16RUsingSSE3
+/*! Used in the global search. The setup per contour pixel is shared by twice as
+    many reference points, so it is faster than two 16*16 calls with the same result.
+    The responses are stored like the results of these two calls one after the other,
+    i.e. the response for the reference point shifted by (x,y) is stored in
+    \c responseBin[(x&16)*16+(x&15)+16*y]. The pointer must be aligned on 16 bytes.
+ */
+void responseX32Y16RUsingSSE3(const CNSResponse* srcPixel, int srcOfs, signed short* responseBin, const CodedContour& contour);
+
 //! scales and shifts a raw response converting it from uint16 to signed int16
 /*! \x (uint16) is mapped to \c x*scale>>16+offset. \c scale must be >=0.
  */
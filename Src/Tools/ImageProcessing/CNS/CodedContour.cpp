@@ -10,6 +10,11 @@ void CodedContour::evaluateX16Y16(signed short responseBin[16][16], const CNSIma
   responseX16Y16RUsingSSE3(&img(x + referenceX, y + referenceY), img.width * sizeof(CNSResponse), &responseBin[0][0], *this);
 }
 
+void CodedContour::evaluateX32Y16(signed short responseBin[2][16][16], const CNSImage& img, int x, int y) const
+{
+  responseX32Y16RUsingSSE3(&img(x + referenceX, y + referenceY), img.width * sizeof(CNSResponse), &responseBin[0][0][0], *this);
+}
+
 void CodedContour::evaluateX8Y8(signed short responseBin[8][8], const CNSImage& img, int x, int y) const
 {
   responseX8Y8RUsingSSE3(&img(x + referenceX, y + referenceY), img.width * sizeof(CNSResponse), &responseBin[0][0], *this);
@@ -188,6 +188,10 @@ public:
   //! See \c evaluateX16Y16
   void evaluateX8Y8(signed short responseBin[8][8], const CNSImage& img, int x = 0, int y = 0) const;
 
+  //! See \c evaluateX16Y16, but for the 32x16 reference points following
+  /*! responseBin[0] contains the left and responseBin[1] the right 16x16 reference points */
+  void evaluateX32Y16(signed short responseBin[2][16][16], const CNSImage& img, int x = 0, int y = 0) const;
+
   //! Computes a circular contour of radius \c around \c 0
   static CodedContour circle(int r);
 };
@@ -1,5 +1,6 @@
 #include "LutRasterizer.h"
 #include "CNSSSE.h"
+#include <cstdio>
 
 using namespace std;
 
@@ -24,45 +25,91 @@ void LutRasterizer::loadOrCreate(const TriangleMesh& object, const Eigen::Aligne
   }
 }
 
+//! The header of a file written by \c saveVertexList
+struct VertexListFileHeader
+{
+  enum {MAGIC = 0x5254554c, VERSION = 1}; // "LUTR"
+  unsigned magic = MAGIC;
+  unsigned version = VERSION;
+  unsigned entries = 0; // The number of vertex lists
+  unsigned reserved = 0; // Makes the padding explicit
+  unsigned long long key = 0; // See LutRasterizer::parameterKey
+};
+
 bool LutRasterizer::loadVertexList(const char* filename)
 {
+  if(filename == nullptr)
+    return false;
   FILE* f = fopen(filename, "rb");
   if(f == nullptr)
     return false;
-  for(int idx = 0; idx < static_cast<int>(vertexList.size()); idx++)
+
+  VertexListFileHeader header;
+  bool valid = fread(&header, sizeof(header), 1, f) == 1
+               && header.magic == VertexListFileHeader::MAGIC
+               && header.version == VertexListFileHeader::VERSION
+               && header.key == parameterKey()
+               && header.entries == vertexList.size();
+  for(int idx = 0; valid && idx < static_cast<int>(vertexList.size()); idx++)
   {
     int ctr;
-    fread(&ctr, sizeof(ctr), 1, f);
-    vertexList[idx].resize(ctr);
-    if(ctr > 0)
-      fread(&vertexList[idx][0], sizeof(vertexList[idx][0]), ctr, f);
-    if(feof(f) || ferror(f))
+    valid = fread(&ctr, sizeof(ctr), 1, f) == 1 && ctr >= 0;
+    if(valid)
     {
-      vertexList.clear();
-      fclose(f);
-      return false;
+      vertexList[idx].resize(ctr);
+      valid = ctr == 0 || fread(&vertexList[idx][0], sizeof(vertexList[idx][0]), ctr, f) == static_cast<size_t>(ctr);
     }
   }
   char x;
-  if(fread(&x, sizeof(x), 1, f) != 0)
-  {
-    vertexList.clear();
-    return false; // file should have an end
-  }
+  valid &= fread(&x, sizeof(x), 1, f) == 0; // file should have an end
   fclose(f);
-  return true;
+
+  if(!valid)
+    for(VertexList& vl : vertexList)
+      vl.clear();
+  return valid;
 }
 
-void LutRasterizer::saveVertexList(const char* filename) const
+bool LutRasterizer::saveVertexList(const char* filename) const
 {
   FILE* f = fopen(filename, "wb");
-  for(int idx = 0; idx < static_cast<int>(vertexList.size()); idx++)
+  if(f == nullptr)
+    return false;
+  VertexListFileHeader header;
+  header.key = parameterKey();
+  header.entries = static_cast<unsigned>(vertexList.size());
+  bool success = fwrite(&header, sizeof(header), 1, f) == 1;
+  for(int idx = 0; success && idx < static_cast<int>(vertexList.size()); idx++)
   {
     int ctr = static_cast<int>(vertexList[idx].size());
-    fwrite(&ctr, sizeof(ctr), 1, f);
-    fwrite(&vertexList[idx][0], sizeof(vertexList[idx][0]), ctr, f);
+    success = fwrite(&ctr, sizeof(ctr), 1, f) == 1
+              && (ctr == 0 || fwrite(&vertexList[idx][0], sizeof(vertexList[idx][0]), ctr, f) == static_cast<size_t>(ctr));
   }
-  fclose(f);
+  success &= fclose(f) == 0;
+  if(!success)
+    remove(filename); // Do not leave a truncated file behind
+  return success;
+}
+
+unsigned long long LutRasterizer::parameterKey() const
+{
+  // FNV-1a over the binary representation of all parameters
+  unsigned long long key = 0xcbf29ce484222325ull;
+  const auto add = [&key](const void* data, size_t size)
+  {
+    for(const unsigned char* p = static_cast<const unsigned char*>(data); size; --size, ++p)
+      key = (key ^ *p) * 0x100000001b3ull;
+  };
+  for(const Eigen::Vector3d& v : object.vertex)
+    add(v.data(), 3 * sizeof(double));
+  for(const TriangleMesh::Face& face : object.face)
+    add(face.vertex, sizeof(face.vertex));
+  add(&object.isRotationalSymmetricZ, sizeof(object.isRotationalSymmetricZ));
+  add(viewpointRange.min().data(), 3 * sizeof(double));
+  add(viewpointRange.max().data(), 3 * sizeof(double));
+  add(&spacing, sizeof(spacing));
+  add(vertexListSize, sizeof(vertexListSize));
+  return key;
 }
 
 void LutRasterizer::allocateLut(const Eigen::AlignedBox3d& viewpointRange, double spacing)
@@ -89,8 +89,9 @@ public:
   void create(const TriangleMesh& object, const Eigen::AlignedBox3d& viewpointRange, double spacing);
 
   //! Same as \c create but tries to load and saves the look-up-table in \c filename
-  /*! Note: At the moment the user has to take care to delete \c filename the parameters have been changed.
-      If \c filename is \c nullptr, the table is neither loaded nor saved.
+  /*! The file contains a key computed from \c object, \c viewpointRange and \c spacing
+      (see \c parameterKey). If it does not match, the table is computed again and the
+      file is overwritten. If \c filename is \c nullptr, the table is neither loaded nor saved.
    */
   void loadOrCreate(const TriangleMesh& object, const Eigen::AlignedBox3d& viewpointRange, double spacing, const char* filename = nullptr);
 
@@ -222,12 +223,18 @@ public:
                          const Eigen::Isometry3d& object2World, const CameraModelOpenCV& camera) const;
 
   //! Tries to load \c vertexList from \c filename
-  /*! \c vertexList must already be allocated and all parameter set. If loading fails, \c false is returned.
+  /*! \c vertexList must already be allocated and all parameter set. If loading fails
+      or the file was created with different parameters, \c false is returned.
    */
   bool loadVertexList(const char* filename);
 
   //! Save \c vertexList such that it can be loaded by \c loadVertexList and \c loadOrCreate.
-  void saveVertexList(const char* filename) const;
+  /*! If the file cannot be written, \c false is returned. */
+  bool saveVertexList(const char* filename) const;
+
+  //! Computes a hash of all parameters the look-up-table \c vertexList depends on
+  /*! This are the geometry of \c object, \c viewpointRange and \c spacing. */
+  unsigned long long parameterKey() const;
 
   //! Returns the memory consumption of \c this
   int memory() const
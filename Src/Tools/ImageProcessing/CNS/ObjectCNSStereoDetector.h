@@ -228,7 +228,8 @@ public:
 
       If the maximum is smaller than the input \c maxVal, \c maxVal, \c argMaxX and \c argMaxY do not change.
 
-      \c blockX and \c blockY must be multiples of 16.
+      \c blockX and \c blockY must be multiples of 16. The block is evaluated in
+      32*16 pieces as far as possible.
    */
   void responseXYMax(int& maxVal, int& argMaxX, int& argMaxY,
                      const CNSImage& cns, const Eigen::Isometry3d& object2World,
@@ -13,7 +13,7 @@
 #include "Tools/ImageProcessing/PixelTypes.h"
 #include "Platform/File.h"
 
-#ifndef TARGET_ROBOT
+#if !defined TARGET_ROBOT && !defined TARGET_TOOL
 
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -70,7 +70,7 @@ public:
   Pixel& operator[](const Vector2i& p) { return image[p.y() * width + p.x()]; }
   const Pixel& operator[](const Vector2i& p) const { return image[p.y() * width + p.x()]; }
 
-#ifndef TARGET_ROBOT
+#if !defined TARGET_ROBOT && !defined TARGET_TOOL
   static std::string expandImageFileName(const std::string& fileName, int imageNumber)
   {
     std::string name = fileName;
@@ -283,7 +283,7 @@ using GrayscaledImage = Image<PixelTypes::GrayscaledPixel>;
 using YUYVImage = Image<PixelTypes::YUYVPixel>;
 using BGRAPixel = Image<PixelTypes::BGRAPixel>;
 
-#ifndef TARGET_ROBOT
+#if !defined TARGET_ROBOT && !defined TARGET_TOOL
 template<> inline bool Image<PixelTypes::GrayscaledPixel>::exportImage(const std::string& fileName, const int imageNumber, const ExportMode mode) const
 {
   const std::string name = expandImageFileName(fileName, imageNumber);
@@ -88,7 +88,17 @@ Logger::Logger(const Configuration& config)
 
   if(enabled)
   {
-    typeInfo << TypeInfo();
+    typeInfo << TypeInfo::getCurrent();
+
+    // Blackboard slots and message ids are only looked up once.
+    for(const RepresentationsPerThread& rpt : representationsPerThread)
+    {
+      loggedRepresentations.emplace_back();
+      for(const std::string& representation : rpt.representations)
+        loggedRepresentations.back().push_back({BlackboardSlot<Streamable>(representation.c_str()), representation,
+                                                static_cast<MessageID>(TypeRegistry::getEnumValue(typeid(MessageID).name(), "id" + representation))});
+    }
+
     InMapFile stream("teamList.cfg");
     if(stream.exists())
       stream >> teamList;
@@ -148,8 +158,8 @@ void Logger::execute(const std::string& threadName)
 
   if(logging)
   {
-    for(const RepresentationsPerThread& rpt : representationsPerThread)
-      if(rpt.thread == threadName && !rpt.representations.empty())
+    for(std::size_t i = 0; i < representationsPerThread.size(); ++i)
+      if(representationsPerThread[i].thread == threadName && !representationsPerThread[i].representations.empty())
       {
         MessageQueue* buffer = nullptr;
         {
@@ -169,18 +179,18 @@ void Logger::execute(const std::string& threadName)
         buffer->out.bin << threadName;
         buffer->out.finishMessage(idFrameBegin);
 
-        for(const std::string& representation : rpt.representations)
+        for(const LoggedRepresentation& representation : loggedRepresentations[i])
 #ifndef NDEBUG
-          if(Blackboard::getInstance().exists(representation.c_str()))
+          if(Blackboard::getInstance().exists(representation.slot))
 #endif
           {
-            buffer->out.bin << Blackboard::getInstance()[representation.c_str()];
-            if(!buffer->out.finishMessage(static_cast<MessageID>(TypeRegistry::getEnumValue(typeid(MessageID).name(), "id" + representation))))
-              OUTPUT_WARNING("Logger: Representation " << representation << " did not fit into buffer!");
+            buffer->out.bin << Blackboard::getInstance()[representation.slot];
+            if(!buffer->out.finishMessage(representation.id))
+              OUTPUT_WARNING("Logger: Representation " << representation.name << " did not fit into buffer!");
           }
 #ifndef NDEBUG
           else
-            OUTPUT_WARNING("Logger: Representation " << representation << " does not exists!");
+            OUTPUT_WARNING("Logger: Representation " << representation.name << " does not exists!");
 #endif
 
         Global::getAnnotationManager().getOut().copyAllMessages(*buffer);
@@ -16,6 +16,7 @@
 #include "Platform/Thread.h"
 #include "Tools/Framework/Configuration.h"
 #include "Tools/MessageQueue/MessageQueue.h"
+#include "Tools/Module/Blackboard.h"
 #include "Tools/Streams/AutoStreamable.h"
 #include "Tools/Streams/InStreams.h"
 #include <deque>
@@ -44,12 +45,21 @@ private:
     (std::vector<Team>) teams,
   });
 
+  /** A representation that is logged. */
+  struct LoggedRepresentation
+  {
+    BlackboardSlot<Streamable> slot; /**< The slot of the representation in the blackboard. */
+    std::string name; /**< The name of the representation. */
+    MessageID id; /**< The message id used to log it. */
+  };
+
   DECLARE_SYNC;
   OutBinaryMemory typeInfo; /**< Streamed type information created in main thread and used in logger thread. */
   TeamList teamList; /**< The list of all teams for naming the log file after the opponent. */
   std::vector<MessageQueue> buffers; /**< All buffers to write log data to. */
   std::stack<MessageQueue*> buffersAvailable; /**< The buffers currently available to fill with log data. */
   std::deque<MessageQueue*> buffersToWrite; /**< The buffers already filled that need to be written. */
+  std::vector<std::vector<LoggedRepresentation>> loggedRepresentations; /**< The representations logged, in the same order as in representationsPerThread. */
   char gameInfoThreadName[32]; /**< The thread that started logging and decides to stop it. */
   bool logging = false; /**< Are we currently logging? */
   bool hasLogged = false; /**< Have we logged before (reset when not logging and buffersToWrite is empty)? */
@@ -8,8 +8,54 @@
 
 #include "LoggingTools.h"
 #include "Platform/BHAssert.h"
+#include "Representations/BehaviorControl/ActivationGraph.h"
+#include "Tools/MessageQueue/MessageQueue.h"
+#include <functional>
 #include <regex>
 
+namespace
+{
+  /**
+   * Visits the messages that are kept from a log. Activation graphs that must
+   * bring the whole name table are passed as a key frame.
+   */
+  class KeptMessageVisitor : public MessageHandler
+  {
+    const std::vector<bool>& keepMessage; /**< Which messages are kept? */
+    std::function<void(InMessage&, const ActivationGraph*)> visit; /**< Called for each message kept, with the key frame or nullptr. */
+    ActivationGraph graphs[2]; /**< The ActivationGraph and the TeamActivationGraph so far. */
+    bool previousKept[2] = {true, true}; /**< Was the previous graph of each kind kept? */
+    int index = 0; /**< The number of the current message. */
+
+    bool handleMessage(InMessage& message) override
+    {
+      const bool keep = keepMessage[index++];
+      const ActivationGraph* keyFrame = nullptr;
+      const int kind = message.getMessageID() == idActivationGraph ? 0 : message.getMessageID() == idTeamActivationGraph ? 1 : -1;
+      if(kind != -1)
+      {
+        ActivationGraph& graph = graphs[kind];
+        message.bin >> graph;
+        if(keep && !previousKept[kind] && (graph.firstName != 0 || graph.names.size() != graph.nameTable.size()))
+        {
+          graph.firstName = 0;
+          graph.names = graph.nameTable;
+          keyFrame = &graph;
+        }
+        previousKept[kind] = keep;
+      }
+      if(keep)
+        visit(message, keyFrame);
+      return true;
+    }
+
+  public:
+    KeptMessageVisitor(const std::vector<bool>& keepMessage, const std::function<void(InMessage&, const ActivationGraph*)>& visit) :
+      keepMessage(keepMessage), visit(visit)
+    {}
+  };
+}
+
 std::string LoggingTools::createName(const std::string& prefix, const std::string& headName, const std::string& bodyName,
                                      const std::string& scenario, const std::string& location, const std::string& identifier,
                                      int playerNumber, const std::string& suffix)
@@ -75,3 +121,37 @@ void LoggingTools::parseName(const std::string& logfileName, std::string* prefix
       *suffix = match[3].matched ? match[3].str().substr(1) : "";
   }
 }
+
+void LoggingTools::keepMessages(MessageQueue& queue, const std::vector<bool>& keepMessage)
+{
+  ASSERT(static_cast<int>(keepMessage.size()) == queue.getNumberOfMessages());
+
+  bool rewrite = false;
+  KeptMessageVisitor check(keepMessage, [&](InMessage&, const ActivationGraph* keyFrame) {rewrite |= keyFrame != nullptr;});
+  queue.handleAllMessages(check);
+
+  if(!rewrite)
+  {
+    int message = 0;
+    queue.removeMessages([&](MessageID, size_t) {return !keepMessage[message++];});
+  }
+  else
+  {
+    // Key frames are larger than the graphs they replace, so the log is rebuilt.
+    MessageQueue kept;
+    kept.setSize(queue.getSize());
+    KeptMessageVisitor copy(keepMessage, [&](InMessage& message, const ActivationGraph* keyFrame)
+    {
+      if(keyFrame)
+      {
+        kept.out.bin << *keyFrame;
+        kept.out.finishMessage(message.getMessageID());
+      }
+      else
+        message >> kept;
+    });
+    queue.handleAllMessages(copy);
+    queue.clear();
+    kept.moveAllMessages(queue);
+  }
+}
@@ -11,6 +11,9 @@
 
 #include "Tools/Streams/Enum.h"
 #include <string>
+#include <vector>
+
+class MessageQueue;
 
 namespace LoggingTools
 {
@@ -54,4 +57,13 @@ namespace LoggingTools
    */
   void parseName(const std::string& logfileName, std::string* prefix, std::string* headName, std::string* bodyName,
                  std::string* scenario, std::string* location, std::string* identifier, int* playerNumber, std::string* suffix = nullptr);
+
+  /**
+   * Removes messages from a log. Activation graphs only contain the names that
+   * were added since the previous graph. Therefore, the first graph that is kept
+   * after a removed one is rewritten to contain the whole name table.
+   * @param queue The log. It must not have an index.
+   * @param keepMessage Which messages are kept? One entry per message in the log.
+   */
+  void keepMessages(MessageQueue& queue, const std::vector<bool>& keepMessage);
 }
@@ -98,6 +98,7 @@ ENUM(MessageID,
   idDebugDataResponse,
   idDebugDrawing,
   idDebugDrawing3D,
+  idDebugDrawingPacked,
   idDebugImage,
   idDebugRequest,
   idDebugResponse,
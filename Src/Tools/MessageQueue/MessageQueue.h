@@ -100,6 +100,14 @@ public:
    */
   void removeRepetitions() {queue.removeRepetitions();}
 
+  /**
+   * The method deletes all messages from the queue for which a predicate holds.
+   * This method should not be called during message handling.
+   * @param remove The predicate. It is called for all messages in their order
+   *               with the id and the size of each message.
+   */
+  void removeMessages(const std::function<bool(MessageID, size_t)>& remove) {queue.removeMessages(remove);}
+
   /**
    * The method removes all messages from the queue.
    */
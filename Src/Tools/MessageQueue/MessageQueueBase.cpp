@@ -283,6 +283,7 @@ void MessageQueueBase::removeRepetitions()
       case idDebugImage:
       case idDebugDrawing:
       case idDebugDrawing3D:
+      case idDebugDrawingPacked:
         copy = messagesPerType[idFrameFinished] == 1;
         break;
 
@@ -342,6 +343,31 @@ void MessageQueueBase::removeRepetitions()
   lastMessage = 0;
 }
 
+void MessageQueueBase::removeMessages(const std::function<bool(MessageID, size_t)>& remove)
+{
+  ASSERT(!messageIndex);
+  selectedMessageForReadingPosition = 0;
+  usedSize = 0;
+  int numOfDeleted = 0;
+  for(int i = 0; i < numberOfMessages; ++i)
+  {
+    const int mlength = getMessageSize() + headerSize;
+    if(remove(getMessageID(), getMessageSize()))
+      ++numOfDeleted;
+    else
+    {
+      if(usedSize != selectedMessageForReadingPosition)
+        memmove(buf + usedSize, buf + selectedMessageForReadingPosition, mlength);
+      usedSize += mlength;
+    }
+    selectedMessageForReadingPosition += mlength;
+  }
+  numberOfMessages -= numOfDeleted;
+  readPosition = 0;
+  selectedMessageForReadingPosition = 0;
+  lastMessage = 0;
+}
+
 MessageID MessageQueueBase::getMessageID() const
 {
   MessageID id = static_cast<MessageID>(buf[selectedMessageForReadingPosition]);
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 #include <string>
 
 #include "MessageIDs.h"
@@ -158,6 +159,15 @@ public:
    */
   void removeRepetitions();
 
+  /**
+   * The method deletes all messages from the queue for which a predicate holds.
+   * The remaining messages keep their order. This method should not be called
+   * during message handling.
+   * @param remove The predicate. It is called for all messages in their order
+   *               with the id and the size of each message.
+   */
+  void removeMessages(const std::function<bool(MessageID, size_t)>& remove);
+
   /**
    * Write message ids to a stream as text.
    * @param stream The stream to write to.
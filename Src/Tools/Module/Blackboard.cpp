@@ -8,16 +8,16 @@
 #include "Tools/Streams/Streamable.h"
 #include "Platform/BHAssert.h"
 #include "Platform/SystemCall.h"
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
 #include <unordered_map>
 
 /** The instance of the blackboard of the current thread. */
 static thread_local Blackboard* theInstance = nullptr;
 
-/** The actual type of the map for all entries. */
-class Blackboard::Entries : public std::unordered_map<std::string, Blackboard::Entry> {};
-
-Blackboard::Blackboard() :
-  entries(new Entries)
+Blackboard::Blackboard()
 {
   theInstance = this;
 }
@@ -26,52 +26,60 @@ Blackboard::~Blackboard()
 {
   ASSERT(theInstance == this);
   theInstance = nullptr;
-  ASSERT(entries->size() == 0);
+  ASSERT(std::all_of(entries.begin(), entries.end(), [](const Entry& entry) {return !entry.data;}));
 }
 
-Blackboard::Entry& Blackboard::get(const char* representation)
+int Blackboard::getSlot(const char* representation)
 {
-  return (*entries)[representation];
-}
+  // The slots are shared by the blackboards of all threads. New names are rare after startup.
+  static std::shared_mutex mutex;
+  static std::unordered_map<std::string, int> slots;
 
-const Blackboard::Entry& Blackboard::get(const char* representation) const
-{
-  return entries->find(representation)->second;
+  const std::string name(representation);
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto i = slots.find(name);
+    if(i != slots.end())
+      return i->second;
+  }
+  std::lock_guard<std::shared_mutex> lock(mutex);
+  return slots.emplace(name, static_cast<int>(slots.size())).first->second;
 }
 
-bool Blackboard::exists(const char* representation) const
+void Blackboard::verifySlot(int slot, const char* representation)
 {
-  return entries->find(representation) != entries->end();
+  ASSERT(getSlot(representation) == slot);
 }
 
 Streamable& Blackboard::operator[](const char* representation)
 {
-  Entry& entry = get(representation);
-  ASSERT(entry.data);
-  return *entry.data;
+  const int slot = getSlot(representation);
+  ASSERT(exists(slot));
+  return *entries[slot].data;
 }
 
 const Streamable& Blackboard::operator[](const char* representation) const
 {
-  const Entry& entry = get(representation);
-  ASSERT(entry.data);
-  return *entry.data;
+  const int slot = getSlot(representation);
+  ASSERT(exists(slot));
+  return *entries[slot].data;
 }
 
-void Blackboard::free(const char* representation)
+void Blackboard::free(int slot)
 {
-  Entry& entry = get(representation);
+  Entry& entry = get(slot);
   ASSERT(entry.counter > 0);
   if(--entry.counter == 0)
   {
-    entries->erase(representation);
+    entry.data.reset();
+    entry.reset = nullptr;
     ++version;
   }
 }
 
-void Blackboard::reset(const char* representation)
+void Blackboard::reset(int slot)
 {
-  Entry& entry = get(representation);
+  Entry& entry = get(slot);
   entry.reset(&*entry.data);
 }
 
@@ -10,8 +10,10 @@
 
 #include <memory>
 #include <functional>
+#include <vector>
 
 class Streamable;
+template<typename T> class BlackboardSlot;
 
 /**
  * Helper class to check whether a type has an accessible serialize method.
@@ -22,6 +24,14 @@ struct HasSerialize
   static bool test(void*) {return false;}
 };
 
+/**
+ * The blackboard stores the representations in slots. Each name of a
+ * representation is assigned a slot number when it is used for the first time.
+ * These numbers are the same in the blackboards of all threads. Accessing a
+ * representation through a BlackboardSlot avoids looking up its name. The
+ * methods that accept names are meant for code that is not executed regularly
+ * and for debugging tools.
+ */
 class Blackboard
 {
 private:
@@ -33,8 +43,7 @@ private:
     std::function<void(Streamable*)> reset;
   };
 
-  class Entries; /**< Type of the map for all entries. */
-  std::unique_ptr<Entries> entries; /**< All entries of the blackboard. */
+  std::vector<Entry> entries; /**< All entries of the blackboard, indexed by their slots. */
   int version = 0; /**< A version that is increased with each configuration change. */
 
   /**
@@ -46,13 +55,67 @@ private:
   friend class ThreadFrame; /**< A thread is allowed to set the instance. */
 
   /**
-   * Retrieve the blackboard entry for the name of a representation.
-   * @param representation The name of the representation.
+   * Retrieve the blackboard entry of a slot.
+   * @param slot The slot of the representation.
    * @return The blackboard entry. If it does not exist, it will
    * be created, but not the representation.
    */
-  Entry& get(const char* representation);
-  const Entry& get(const char* representation) const;
+  Entry& get(int slot)
+  {
+    if(static_cast<std::size_t>(slot) >= entries.size())
+      entries.resize(slot + 1);
+    return entries[slot];
+  }
+
+  /**
+   * Does the representation in a certain slot exist?
+   * @param slot The slot of the representation.
+   * @return Does it exist in this blackboard?
+   */
+  bool exists(int slot) const
+  {
+    return static_cast<std::size_t>(slot) < entries.size() && entries[slot].data;
+  }
+
+  /**
+   * Allocate the blackboard entry of a slot for a representation
+   * of a certain type. The representation is only created if this
+   * is its first allocation.
+   * @param T The type of the representation.
+   * @param slot The slot of the representation.
+   * @return The representation.
+   */
+  template<typename T> T& alloc(int slot)
+  {
+    Entry& entry = get(slot);
+    if(entry.counter++ == 0)
+    {
+      entry.data = std::make_unique<T>();
+      if(HasSerialize::test(dynamic_cast<T*>(&*entry.data)))
+        entry.reset = [](Streamable* data)
+      {
+        dynamic_cast<T*>(data)->~T();
+        new(dynamic_cast<T*>(data)) T();
+      };
+      else
+        entry.reset = [](Streamable* data) {};
+      ++version;
+    }
+    return dynamic_cast<T&>(*entry.data);
+  }
+
+  /**
+   * Free the blackboard entry of a slot. It is only removed if it
+   * was freed as often as it was allocated.
+   * @param slot The slot of the representation.
+   */
+  void free(int slot);
+
+  /**
+   * Reset the representation in a slot to its default state.
+   * @param slot The slot of the representation.
+   */
+  void reset(int slot);
 
 public:
   /**
@@ -67,12 +130,28 @@ public:
    */
   ~Blackboard();
 
+  /**
+   * Determine the slot of a representation. A new slot is assigned
+   * if the name was not used before.
+   * @param representation The name of the representation.
+   * @return The slot, which is the same in all blackboards.
+   */
+  static int getSlot(const char* representation);
+
+  /**
+   * Asserts that a slot belongs to a representation with a certain name.
+   * @param slot The slot.
+   * @param representation The name the slot should belong to.
+   */
+  static void verifySlot(int slot, const char* representation);
+
   /**
    * Does a certain representation exist?
    * @param representation The name of the representation.
    * @return Does it exist in this blackboard?
    */
-  bool exists(const char* representation) const;
+  bool exists(const char* representation) const {return exists(getSlot(representation));}
+  template<typename T> bool exists(const BlackboardSlot<T>& slot) const {return exists(slot.index);}
 
   /**
    * Allocate a new blackboard entry for a representation of a
@@ -82,24 +161,8 @@ public:
    * @param representation The name of the representation.
    * @return The representation.
    */
-  template<typename T> T& alloc(const char* representation)
-  {
-    Entry& entry = get(representation);
-    if(entry.counter++ == 0)
-    {
-      entry.data = std::make_unique<T>();
-      if(HasSerialize::test(dynamic_cast<T*>(&*entry.data)))
-        entry.reset = [](Streamable* data)
-      {
-        dynamic_cast<T*>(data)->~T();
-        new(dynamic_cast<T*>(data)) T();
-      };
-      else
-        entry.reset = [](Streamable* data) {};
-      ++version;
-    }
-    return dynamic_cast<T&>(*entry.data);
-  }
+  template<typename T> T& alloc(const char* representation) {return alloc<T>(getSlot(representation));}
+  template<typename T> T& alloc(const BlackboardSlot<T>& slot) {return alloc<T>(slot.index);}
 
   /**
    * Free the blackboard entry for a representation of a certain
@@ -107,14 +170,16 @@ public:
    * allocated.
    * @param representation The name of the representation.
    */
-  void free(const char* representation);
+  void free(const char* representation) {free(getSlot(representation));}
+  template<typename T> void free(const BlackboardSlot<T>& slot) {free(slot.index);}
 
   /**
    * Reset the blackboard entry for a representation of a certain
    * name to its default state.
    * @param representation The name of the representation.
    */
-  void reset(const char* representation);
+  void reset(const char* representation) {reset(getSlot(representation));}
+  template<typename T> void reset(const BlackboardSlot<T>& slot) {reset(slot.index);}
 
   /**
    * Access a representation of a certain name. The representation
@@ -125,6 +190,15 @@ public:
   Streamable& operator[](const char* representation);
   const Streamable& operator[](const char* representation) const;
 
+  /**
+   * Access a representation through its slot. The representation
+   * must already exist.
+   * @param slot The slot of the representation.
+   * @return The instance of the representation in the blackboard.
+   */
+  template<typename T> T& operator[](const BlackboardSlot<T>& slot) {return static_cast<T&>(*entries[slot.index].data);}
+  template<typename T> const T& operator[](const BlackboardSlot<T>& slot) const {return static_cast<const T&>(*entries[slot.index].data);}
+
   /**
    * Return the current version.
    * It can be used to determine whether the configuration of the
@@ -140,3 +214,39 @@ public:
    */
   static Blackboard& getInstance();
 };
+
+/**
+ * A handle for the slot of a representation of a certain type. The name
+ * of the representation is only looked up when the handle is created.
+ * @param T The type of the representation.
+ */
+template<typename T> class BlackboardSlot
+{
+private:
+  int index; /**< The slot in all blackboards. */
+  friend class Blackboard;
+
+public:
+  /**
+   * Determines the slot of a representation.
+   * @param representation The name of the representation.
+   */
+  explicit BlackboardSlot(const char* representation) : index(Blackboard::getSlot(representation)) {}
+
+  /**
+   * Returns the slot of the representation named after its type, which is the
+   * case for all representations modules provide or require. It is only
+   * determined when this method is called for the first time. Therefore,
+   * all calls must pass the same name, which is checked in debug builds.
+   * @param representation The name of the type.
+   * @return The slot.
+   */
+  static const BlackboardSlot& get(const char* representation)
+  {
+    static const BlackboardSlot slot(representation);
+#ifndef NDEBUG
+    Blackboard::verifySlot(slot.index, representation);
+#endif
+    return slot;
+  }
+};
@@ -144,6 +144,7 @@ public:
   friend class ModuleGraphCreator; /**< The ModuleGraphCreator gathers all private data. */
   friend class ModuleGraphRunner; /**< To create new modules. */
   friend class Debug; /**< To send the ModuleTabe. */
+  friend class Benchmark; /**< To select the modules benchmarked. */
 };
 
 /**
@@ -469,8 +470,8 @@ void saveModuleParameters(const Streamable& parameters, const char* moduleName,
 #define _MODULE_DECLARE_PROVIDES_WITHOUT_MODIFY(type) _MODULE_PROVIDES(type, \
     _MODULE_VERIFY(r) \
     _MODULE_DRAW(r))
-#define _MODULE_DECLARE_REQUIRES(type) public: const type& the##type = Blackboard::getInstance().alloc<type>(#type);
-#define _MODULE_DECLARE_USES(type) public: const type& the##type = Blackboard::getInstance().alloc<type>(#type);
+#define _MODULE_DECLARE_REQUIRES(type) public: const type& the##type = Blackboard::getInstance().alloc(BlackboardSlot<type>::get(#type));
+#define _MODULE_DECLARE_USES(type) public: const type& the##type = Blackboard::getInstance().alloc(BlackboardSlot<type>::get(#type));
 #define _MODULE_DECLARE__MODULE_DEFINES_PARAMETERS(...)
 #define _MODULE_DECLARE__MODULE_LOADS_PARAMETERS(...)
 
@@ -480,10 +481,10 @@ void saveModuleParameters(const Streamable& parameters, const char* moduleName,
  * @param x The type name of a representation or the set of all parameters.
  */
 #define _MODULE_FREE(x) _MODULE_JOIN(_MODULE_FREE_, x)
-#define _MODULE_FREE_PROVIDES(type) if(_the##type) Blackboard::getInstance().free(#type);
-#define _MODULE_FREE_PROVIDES_WITHOUT_MODIFY(type) if(_the##type) Blackboard::getInstance().free(#type);
-#define _MODULE_FREE_REQUIRES(type) Blackboard::getInstance().free(#type);
-#define _MODULE_FREE_USES(type) Blackboard::getInstance().free(#type);
+#define _MODULE_FREE_PROVIDES(type) if(_the##type) Blackboard::getInstance().free(BlackboardSlot<type>::get(#type));
+#define _MODULE_FREE_PROVIDES_WITHOUT_MODIFY(type) if(_the##type) Blackboard::getInstance().free(BlackboardSlot<type>::get(#type));
+#define _MODULE_FREE_REQUIRES(type) Blackboard::getInstance().free(BlackboardSlot<type>::get(#type));
+#define _MODULE_FREE_USES(type) Blackboard::getInstance().free(BlackboardSlot<type>::get(#type));
 #define _MODULE_FREE__MODULE_DEFINES_PARAMETERS(...)
 #define _MODULE_FREE__MODULE_LOADS_PARAMETERS(...)
 
@@ -523,7 +524,7 @@ void saveModuleParameters(const Streamable& parameters, const char* moduleName,
   { \
     static_cast<BaseType&>(module).modifyParameters(); \
     if(!static_cast<BaseType&>(module)._the##type) \
-      static_cast<BaseType&>(module)._the##type = &Blackboard::getInstance().alloc<type>(#type); \
+      static_cast<BaseType&>(module)._the##type = &Blackboard::getInstance().alloc(BlackboardSlot<type>::get(#type)); \
     type& r(*static_cast<BaseType&>(module)._the##type); \
     BH_TRACE; \
     STOPWATCH(#type) static_cast<BaseType&>(module).update(r); \
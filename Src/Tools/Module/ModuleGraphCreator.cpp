@@ -12,10 +12,10 @@
 #include "Tools/Settings.h"
 
 #include <algorithm>
-#include <map>
 
 ModuleGraphCreator::ModuleGraphCreator(const Configuration& config)
-  : required(config().size()), received(config().size()), sent(config().size()), providers(config().size()), typeInfo(true)
+  : required(config().size()), received(config().size()), sent(config().size()), providers(config().size()),
+    representationsToReset(config().size())
 {
   for(auto& r : received)
     r.resize(config().size());
@@ -280,7 +280,9 @@ bool ModuleGraphCreator::update(In& stream)
   for(auto& thread : received)
     for(std::vector<const char*>& r : thread)
       r.clear();
-  representationsToReset.clear();
+
+  for(std::vector<std::string>& r : representationsToReset)
+    r.clear();
 
   // Remove all markings
   for(std::vector<bool>& r : required)
@@ -343,32 +345,25 @@ bool ModuleGraphCreator::update(In& stream)
   }
 
   // Append all blackboard entries that are now provided by a different module or no module anymore.
-  std::multimap<std::string, std::string> currentProviders;
-  for(const Configuration::Thread& thread : config())
-  {
-    for(const auto& currentProvider : thread.representationProviders)
-      currentProviders.emplace(currentProvider.representation, currentProvider.provider);
-  }
-  for(const Configuration::Thread& thread : prevConfig())
+  // This is done per thread, so threads in which nothing changed keep their representations.
+  for(std::size_t j = 0; j < prevConfig().size() && j < config().size(); ++j)
   {
-    for(const auto& prevProvider : thread.representationProviders)
+    const std::vector<Configuration::RepresentationProvider>& currentProviders = config()[j].representationProviders;
+    for(const auto& prevProvider : prevConfig()[j].representationProviders)
     {
-      auto range = currentProviders.equal_range(prevProvider.representation);
-      if(range.first != range.second)
+      // The current providers were sorted by their representations above.
+      auto current = std::lower_bound(currentProviders.begin(), currentProviders.end(), prevProvider);
+      if(current != currentProviders.end() && current->representation == prevProvider.representation)
       {
-        for(auto i = range.first; i != range.second; ++i)
-          if(i->second == prevProvider.provider)
-            goto found;
-        representationsToReset.emplace_back(prevProvider.representation);
-      found:
-        ;
+        if(current->provider != prevProvider.provider)
+          representationsToReset[j].emplace_back(prevProvider.representation);
       }
       else
       {
         // No longer provided -> "default" or "off"
         for(const std::string& representation : config.defaultRepresentations)
           if(representation == prevProvider.representation)
-            representationsToReset.emplace_back(representation);
+            representationsToReset[j].emplace_back(representation);
       }
     }
   }
@@ -463,5 +458,5 @@ const ModuleGraphCreator::ExecutionValues ModuleGraphCreator::getExecutionValues
   for(const Provider& provider : providers[index])
     providerList.emplace_back(provider.representation, provider.moduleBase->name);
 
-  return ExecutionValues(received[index], sent[index], representationsToReset, modulesRequired, providerList);
+  return ExecutionValues(received[index], sent[index], representationsToReset[index], modulesRequired, providerList);
 }
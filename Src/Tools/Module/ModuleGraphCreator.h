@@ -51,11 +51,11 @@ private:
   std::vector<std::vector<std::vector<const char*>>> received; /**< The list of all names of representations received from other threads. */
   std::vector<std::vector<std::vector<const char*>>> sent; /**< The list of all names of representations sent to other threads */
   std::vector<std::list<Provider>> providers; /**< The list of providers of each thread that will be executed. */
-  std::vector<std::string> representationsToReset; /**< The list of all representations that must be reset. */
+  std::vector<std::vector<std::string>> representationsToReset; /**< The list of all representations that must be reset, because their provider changed. */
 
 public:
   Configuration config; /**< The last configuration set. It may not work. */
-  TypeInfo typeInfo; /**< Information about all types. */
+  const TypeInfo& typeInfo = TypeInfo::getCurrent(); /**< Information about all types. */
 
   /**
    * The constructor.
@@ -137,7 +137,7 @@ public: // Passing data to the public:
 
     (std::vector<StringVector>) received, /**< Which data is received from which thread. */
     (std::vector<StringVector>) sent, /**< Which data is sent to which thread. */
-    (std::vector<std::string>) representationsToReset, /**< All representations that must be reset. */
+    (std::vector<std::string>) representationsToReset, /**< All representations of this thread that must be reset. */
     (std::vector<ModuleRequired>) modules, /**< All available modules and whether they need to be executed. */
     (std::vector<Configuration::RepresentationProvider>) providers, /**< All active modules and the order in which they must be executed. */
   });
@@ -67,7 +67,7 @@ void ModuleGraphRunner::update(In& stream)
     if(Blackboard::getInstance().exists(representation.c_str()))
       Blackboard::getInstance().reset(representation.c_str());
 
-  // Delete all modules that are not required anymore
+  // Delete all modules that are not required anymore. All others keep their instances and thereby their state.
   for(auto& m : modules)
   {
     if(!m.second.required && m.second.instance)
@@ -263,6 +263,171 @@ bool InverseKinematic::calcLegJoints(const Pose3f& positionLeft, const Pose3f& p
   return hl <= maxLen &&  hr <= maxLen;
 }
 
+namespace
+{
+  using Lanes = Eigen::Array4f;
+  constexpr size_t numOfLanes = 4;
+
+  /** The targets of one leg relative to its hip for a block of pairs of foot poses (one pair per lane). */
+  struct LegTargets
+  {
+    Lanes rotation[3][3];
+    Lanes translation[3];
+
+    void set(size_t lane, const Pose3f& target)
+    {
+      for(int i = 0; i < 3; ++i)
+      {
+        for(int j = 0; j < 3; ++j)
+          rotation[i][j](lane) = target.rotation(i, j);
+        translation[i](lane) = target.translation(i);
+      }
+    }
+  };
+
+  Lanes atan2(const Lanes& y, const Lanes& x)
+  {
+    return y.binaryExpr(x, [](float y, float x) {return std::atan2(y, x);});
+  }
+
+  /**
+   * Calculates the hip yaw angle a single leg would require.
+   * This is lMinusJoint0 for the left and rJoint0 for the right leg in calcLegJoints above.
+   */
+  Lanes calcHipYaw(const LegTargets& target)
+  {
+    const auto& r = target.rotation;
+    const auto& t = target.translation;
+
+    // footToHip = rotation.inverse() * -translation
+    const Lanes footToHipY = -(r[0][1] * t[0] + r[1][1] * t[1] + r[2][1] * t[2]);
+    const Lanes footToHipZ = -(r[0][2] * t[0] + r[1][2] * t[1] + r[2][2] * t[2]);
+
+    // The second column of aroundX(-atan2(y, z)) * aroundY(...) is parallel to (0, z, -y).
+    const Lanes hipRotationC1X = r[0][1] * footToHipZ - r[0][2] * footToHipY;
+    const Lanes hipRotationC1Y = r[1][1] * footToHipZ - r[1][2] * footToHipY;
+    return atan2(-hipRotationC1X, hipRotationC1Y);
+  }
+
+  /**
+   * Calculates the angles of the remaining five joints of a leg after its hip was rotated.
+   * @param target The target of the leg relative to its hip.
+   * @param cosYaw The cosine of the rotation of the hip around the z axis.
+   * @param sinYaw The sine of the rotation of the hip around the z axis.
+   * @param hipRollOffset The offset of the hip roll joint (pi_4 for the left leg, -pi_4 for the right one).
+   * @param h1 The length of the upper leg.
+   * @param h2 The length of the lower leg.
+   * @param angles The resulting angles of hip roll, hip pitch, knee pitch, ankle pitch, and ankle roll.
+   * @param length The resulting distance between the hip and the foot.
+   */
+  void solveLeg(const LegTargets& target, const Lanes& cosYaw, const Lanes& sinYaw, float hipRollOffset,
+                float h1, float h2, Lanes angles[5], Lanes& length)
+  {
+    const auto& r = target.rotation;
+    const auto& t = target.translation;
+
+    // hipToFoot = aroundZ(yaw) * translation
+    const Lanes hipToFootX = cosYaw * t[0] - sinYaw * t[1];
+    const Lanes hipToFootY = sinYaw * t[0] + cosYaw * t[1];
+    const Lanes& hipToFootZ = t[2];
+
+    // footRotationC2 before the rotations that depend on the hip roll and pitch, i.e. (aroundZ(yaw) * rotation).col(2)
+    const Lanes c2X = cosYaw * r[0][2] - sinYaw * r[1][2];
+    const Lanes c2Y = sinYaw * r[0][2] + cosYaw * r[1][2];
+    const Lanes& c2Z = r[2][2];
+
+    const Lanes yzLength = (hipToFootY.square() + hipToFootZ.square()).sqrt();
+    const Lanes pitchX = yzLength * -hipToFootZ.sign();
+    const Lanes pitchLength = (hipToFootX.square() + pitchX.square()).sqrt();
+    const Lanes rollAngle = -atan2(-hipToFootY, -hipToFootZ);
+    const Lanes pitchMinusAlpha = atan2(-hipToFootX, pitchX);
+
+    // Rotate around x by -rollAngle, whose cosine and sine are directly given by the hip to foot vector ...
+    const Lanes cosRoll = -hipToFootZ / yzLength;
+    const Lanes sinRoll = -hipToFootY / yzLength;
+    const Lanes rolledY = cosRoll * c2Y - sinRoll * c2Z;
+    const Lanes rolledZ = sinRoll * c2Y + cosRoll * c2Z;
+
+    // ... and around y by -pitchMinusAlpha.
+    const Lanes cosPitch = pitchX / pitchLength;
+    const Lanes sinPitch = hipToFootX / pitchLength;
+    const Lanes footRotationC2X = cosPitch * c2X + sinPitch * rolledZ;
+    const Lanes& footRotationC2Y = rolledY;
+    const Lanes footRotationC2Z = cosPitch * rolledZ - sinPitch * c2X;
+
+    length = (hipToFootX.square() + yzLength.square()).sqrt();
+    const Lanes lengthSqr = length.square();
+    const float h1Sqr = h1 * h1;
+    const float h2Sqr = h2 * h2;
+    const Lanes cosMinusAlpha = (h1Sqr + lengthSqr - h2Sqr) / (2.f * h1 * length);
+    const Lanes cosMinusBeta = (h2Sqr + lengthSqr - h1Sqr) / (2.f * h2 * length);
+    const Lanes alpha = -cosMinusAlpha.max(-1.f).min(1.f).acos();
+    const Lanes beta = -cosMinusBeta.max(-1.f).min(1.f).acos();
+
+    angles[0] = rollAngle + hipRollOffset;
+    angles[1] = pitchMinusAlpha + alpha;
+    angles[2] = -alpha - beta;
+    angles[3] = atan2(footRotationC2X, footRotationC2Z) + beta;
+    angles[4] = (-footRotationC2Y).asin();
+  }
+}
+
+unsigned InverseKinematic::calcLegJoints(const Pose3f* positionsLeft, const Pose3f* positionsRight, size_t count, const Quaternionf& bodyRotation,
+                                         JointAngles* jointAngles, bool* reachable, const RobotDimensions& robotDimensions, float ratio)
+{
+  Rangef::ZeroOneRange().clamp(ratio);
+
+  // The parts of the transformations that are the same for all pairs
+  const Pose3f leftHip = (Pose3f(RotationMatrix::aroundX(-pi_4)) + Vector3f(0.f, -robotDimensions.yHipOffset, 0.f)) *= bodyRotation.inverse();
+  const Pose3f rightHip = (Pose3f(RotationMatrix::aroundX(pi_4)) + Vector3f(0.f, robotDimensions.yHipOffset, 0.f)) *= bodyRotation.inverse();
+  const Vector3f footHeight(0.f, 0.f, robotDimensions.footHeight);
+  const float h1 = robotDimensions.upperLegLength;
+  const float h2 = robotDimensions.lowerLegLength;
+  const float maxLen = h1 + h2;
+
+  unsigned numOfReachable = 0;
+  for(size_t first = 0; first < count; first += numOfLanes)
+  {
+    const size_t usedLanes = std::min(numOfLanes, count - first);
+
+    // Unused lanes of the last block repeat the last pair.
+    LegTargets left;
+    LegTargets right;
+    for(size_t lane = 0; lane < numOfLanes; ++lane)
+    {
+      const size_t i = first + std::min(lane, usedLanes - 1);
+      left.set(lane, (Pose3f(leftHip) *= positionsLeft[i]) += footHeight);
+      right.set(lane, (Pose3f(rightHip) *= positionsRight[i]) += footHeight);
+    }
+
+    const Lanes hipYawPitch = -calcHipYaw(left) * ratio + calcHipYaw(right) * (1.f - ratio);
+    const Lanes cosYaw = hipYawPitch.cos();
+    const Lanes sinYaw = hipYawPitch.sin();
+    Lanes leftAngles[5];
+    Lanes rightAngles[5];
+    Lanes leftLength;
+    Lanes rightLength;
+    solveLeg(left, cosYaw, sinYaw, pi_4, h1, h2, leftAngles, leftLength);
+    solveLeg(right, cosYaw, -sinYaw, -pi_4, h1, h2, rightAngles, rightLength);
+
+    for(size_t lane = 0; lane < usedLanes; ++lane)
+    {
+      JointAngles& result = jointAngles[first + lane];
+      result.angles[Joints::lHipYawPitch] = result.angles[Joints::rHipYawPitch] = hipYawPitch(lane);
+      for(int j = 0; j < 5; ++j)
+      {
+        result.angles[Joints::lHipRoll + j] = leftAngles[j](lane);
+        result.angles[Joints::rHipRoll + j] = rightAngles[j](lane);
+      }
+      const bool isReachable = leftLength(lane) <= maxLen && rightLength(lane) <= maxLen;
+      if(reachable)
+        reachable[first + lane] = isReachable;
+      numOfReachable += isReachable ? 1 : 0;
+    }
+  }
+  return numOfReachable;
+}
+
 void InverseKinematic::calcHeadJoints(const Vector3f& position, const Angle imageTilt, const RobotDimensions& robotDimensions,
                                       CameraInfo::Camera camera, Vector2a& panTilt, const CameraCalibration& cameraCalibration)
 {
@@ -56,6 +56,25 @@ namespace InverseKinematic
                                    const RobotDimensions& robotDimensions, float ratio = 0.5f);
   [[nodiscard]] bool calcLegJoints(const Pose3f& positionLeft, const Pose3f& positionRight, const Quaternionf& bodyRotation, JointAngles& jointAngles,
                                    const RobotDimensions& robotDimensions, float ratio = 0.5f);
+
+  /**
+   * This method calculates the joint angles for the legs of the robot for several pairs of foot poses at once,
+   * e.g. to evaluate candidate steps in a single motion frame. The results are the same as calling the version above
+   * for each pair (apart from rounding). The transformation to the hips is only computed once and all pairs are
+   * solved in blocks of four using closed forms instead of building intermediate rotation matrices.
+   * @param positionsLeft The desired positions of the left foot points.
+   * @param positionsRight The desired positions of the right foot points.
+   * @param count The number of pairs of foot positions.
+   * @param bodyRotation The rotation of the body around the x-Axis and y-Axis (the same for all pairs).
+   * @param jointAngles The instances of JointAngles where the resulting leg joint angles are written into (count entries).
+   * @param reachable Whether each pair of target positions was reachable (count entries). Can be nullptr.
+   * @param robotDimensions The RobotDimensions needed for calculation
+   * @param ratio The ratio between the left and right yaw angle
+   * @return The number of pairs of target positions that were reachable.
+   */
+  unsigned calcLegJoints(const Pose3f* positionsLeft, const Pose3f* positionsRight, size_t count, const Quaternionf& bodyRotation,
+                         JointAngles* jointAngles, bool* reachable, const RobotDimensions& robotDimensions, float ratio = 0.5f);
+
   /**
    * This method calculates the joint angles for the legs of the robot from a Pose3f in com coordinate system for each leg and the body pitch and roll.
    * Because there is no fast forward solution an iterative algorithm from Colin Graf is used
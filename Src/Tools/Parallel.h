@@ -0,0 +1,153 @@
+/**
+ * @file Parallel.h
+ *
+ * The file declares functions that distribute independent work items
+ * across all processor cores. They are meant for batch processing on the PC,
+ * e.g. of log files, not for the threads running on the robot.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Parallel
+{
+  /**
+   * Returns the number of threads that run concurrently on this computer.
+   * @return The number of threads, at least 1.
+   */
+  inline size_t numOfThreads()
+  {
+    return std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  /**
+   * Calls a function for all numbers in [0, n). The calls are distributed
+   * dynamically over several threads, including the calling one. Therefore,
+   * the order of the calls is not defined. The function returns after all
+   * calls were finished.
+   * @param n The number of calls.
+   * @param function The function that is called with each number.
+   * @param threads The maximum number of threads used. 0 means one per core.
+   */
+  inline void forEach(size_t n, const std::function<void(size_t)>& function, size_t threads = 0)
+  {
+    threads = std::min(threads ? threads : numOfThreads(), n);
+    if(threads <= 1)
+    {
+      for(size_t i = 0; i < n; ++i)
+        function(i);
+      return;
+    }
+
+    std::atomic<size_t> next(0);
+    const auto work = [&]
+    {
+      for(size_t i = next++; i < n; i = next++)
+        function(i);
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for(size_t i = 1; i < threads; ++i)
+      workers.emplace_back(work);
+    work();
+    for(std::thread& worker : workers)
+      worker.join();
+  }
+
+  /**
+   * A pool of threads that execute tasks in the background while the thread
+   * that adds them continues, e.g. with reading the next frame of a log file.
+   * The number of pending tasks is limited, i.e. adding a task blocks while
+   * the backlog is full. This limits the memory the data of the tasks uses.
+   */
+  class Workers
+  {
+  private:
+    std::vector<std::thread> threads; /**< The worker threads. */
+    std::deque<std::function<void()>> tasks; /**< The tasks not started yet. */
+    std::mutex mutex; /**< Protects the members below and the tasks. */
+    std::condition_variable changed; /**< Signals that a task was added or finished. */
+    size_t maxPendingTasks; /**< The maximum number of tasks not started yet. */
+    size_t runningTasks = 0; /**< The number of tasks currently executed. */
+    bool terminate = false; /**< Should the worker threads terminate? */
+
+  public:
+    /**
+     * Starts the worker threads.
+     * @param numOfThreads The number of worker threads. 0 means one per core.
+     * @param maxPendingTasks The maximum number of tasks not started yet.
+     *                        0 means twice the number of threads.
+     */
+    Workers(size_t numOfThreads = 0, size_t maxPendingTasks = 0) :
+      maxPendingTasks(maxPendingTasks ? maxPendingTasks : 2 * (numOfThreads ? numOfThreads : Parallel::numOfThreads()))
+    {
+      threads.resize(numOfThreads ? numOfThreads : Parallel::numOfThreads());
+      for(std::thread& thread : threads)
+        thread = std::thread([this] {work();});
+    }
+
+    /** Executes all tasks still pending and terminates the worker threads. */
+    ~Workers()
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        terminate = true;
+      }
+      changed.notify_all();
+      for(std::thread& thread : threads)
+        thread.join();
+    }
+
+    /**
+     * Adds a task. Blocks while the maximum number of tasks is already pending.
+     * @param task The task. It must not throw.
+     */
+    void add(std::function<void()>&& task)
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      changed.wait(lock, [this] {return tasks.size() < maxPendingTasks;});
+      tasks.emplace_back(std::move(task));
+      lock.unlock();
+      changed.notify_all();
+    }
+
+    /** Waits until all tasks added were executed. */
+    void wait()
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      changed.wait(lock, [this] {return tasks.empty() && !runningTasks;});
+    }
+
+  private:
+    /** The main loop of each worker thread. */
+    void work()
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      while(true)
+      {
+        changed.wait(lock, [this] {return terminate || !tasks.empty();});
+        if(tasks.empty())
+          return;
+        std::function<void()> task = std::move(tasks.front());
+        tasks.pop_front();
+        ++runningTasks;
+        lock.unlock();
+        changed.notify_all();
+        task();
+        lock.lock();
+        --runningTasks;
+        changed.notify_all();
+      }
+    }
+  };
+}
@@ -44,7 +44,7 @@ Settings::Settings()
   {
     int index = atoi(RoboCupCtrl::controller->getRobotName().c_str() + 5) - 1;
     teamNumber = index < 6 ? 1 : 2;
-    teamPort = 10000 + teamNumber;
+    teamPort = 10000 + RoboCupCtrl::controller->teamPortOffset + teamNumber;
     teamColor = index < 6
                 ? TeamColor(RoboCupCtrl::controller->gameController.teamInfos[0].teamColor)
                 : TeamColor(RoboCupCtrl::controller->gameController.teamInfos[1].teamColor);
@@ -253,6 +253,18 @@
 /** Generate streaming code from declaration. */
 #define _STREAM_SER(seq) {auto& _var = _STREAM_VAR(seq); Streaming::streamIt(in, out, #seq, _var);}
 
+/** Generate code for binary streams from declaration. */
+#define _STREAM_WRITE(seq) Streaming::writeBinary(*out, _STREAM_VAR(seq));
+#define _STREAM_READ(seq) Streaming::readBinary(*in, _STREAM_VAR(seq));
+#define _STREAM_PACK(seq) Streaming::packBinary(_pos, _STREAM_VAR(seq));
+#define _STREAM_UNPACK(seq) Streaming::unpackBinary(_pos, _STREAM_VAR(seq));
+
+/** Generate a term that is only true if the declared attribute is streamed as a block. */
+#define _STREAM_IS_BLOCK(seq) && Streaming::IsBinaryBlock<decltype(_STREAM_VAR(seq))>::value
+
+/** Generate a term that adds the size of the declared attribute. */
+#define _STREAM_SIZE(seq) + sizeof(_STREAM_VAR(seq))
+
 /** Generate the actual declaration. */
 #define _STREAM_DECL(seq) decltype(Streaming::TypeWrapper<_STREAM_DECL_I seq))>::type) _STREAM_VAR(seq) _STREAM_INIT(seq);
 #define _STREAM_DECL_I(...) _STREAM_VAR(__VA_ARGS__) _STREAM_DROP(_STREAM_DROP(
@@ -273,8 +285,11 @@
   struct name : public base \
   _STREAM_UNWRAP header; \
   _STREAM_STREAMABLE_I(_STREAM_TUPLE_SIZE(__VA_ARGS__), name, base, streamBase, __VA_ARGS__)
-#define _STREAM_STREAMABLE_I(n, name, base, streamBase, ...) _STREAM_STREAMABLE_II(n, name, base, streamBase, (_STREAM_SER, __VA_ARGS__), (_STREAM_DECL, __VA_ARGS__), (_STREAM_REG, __VA_ARGS__))
-#define _STREAM_STREAMABLE_II(n, theName, base, streamBase, params1, params2, params3) \
+#define _STREAM_STREAMABLE_I(n, name, base, streamBase, ...) \
+  _STREAM_STREAMABLE_II(n, name, base, streamBase, (_STREAM_SER, __VA_ARGS__), (_STREAM_DECL, __VA_ARGS__), (_STREAM_REG, __VA_ARGS__), \
+                        (_STREAM_WRITE, __VA_ARGS__), (_STREAM_READ, __VA_ARGS__), (_STREAM_PACK, __VA_ARGS__), (_STREAM_UNPACK, __VA_ARGS__), \
+                        (_STREAM_IS_BLOCK, __VA_ARGS__), (_STREAM_SIZE, __VA_ARGS__))
+#define _STREAM_STREAMABLE_II(n, theName, base, streamBase, params1, params2, params3, params4, params5, params6, params7, params8, params9) \
     _STREAM_ATTR_##n params2 \
   protected: \
     friend struct Streaming::OnRead<theName, true>; \
@@ -282,7 +297,41 @@
     { \
       PUBLISH(_reg); \
       streamBase \
-      _STREAM_ATTR_##n params1 \
+      if(in ? in->isBinary() : out->isBinary()) \
+      { \
+        /* Binary streams neither need the names nor the nesting of the attributes. If all of them */ \
+        /* are laid out as in memory and they are small, they are copied with a single access. */ \
+        constexpr bool _packed = true _STREAM_ATTR_##n params8 && 0 _STREAM_ATTR_##n params9 <= 1024; \
+        constexpr size_t _size = 0 _STREAM_ATTR_##n params9; \
+        if constexpr(_packed) \
+        { \
+          char _buffer[_packed && _size ? _size : 1]; \
+          if(in) \
+          { \
+            in->read(_buffer, _size); \
+            [[maybe_unused]] const char* _pos = _buffer; \
+            _STREAM_ATTR_##n params7 \
+          } \
+          else \
+          { \
+            [[maybe_unused]] char* _pos = _buffer; \
+            _STREAM_ATTR_##n params6 \
+            out->write(_buffer, _size); \
+          } \
+        } \
+        else if(in) \
+        { \
+          _STREAM_ATTR_##n params5 \
+        } \
+        else \
+        { \
+          _STREAM_ATTR_##n params4 \
+        } \
+      } \
+      else \
+      { \
+        _STREAM_ATTR_##n params1 \
+      } \
       if(in) \
         Streaming::onRead(*this); \
     } \
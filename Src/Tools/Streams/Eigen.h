@@ -23,6 +23,28 @@ template<typename T, int N> struct EigenMatrixRow
   T elems[N]; /**< The elements of the row or column. */
 };
 
+namespace Streaming
+{
+  /** Rows and columns of Eigen matrices are streamed as their elements. */
+  template<typename T, int N> struct IsBinaryBlock<EigenMatrixRow<T, N>> : IsBinaryBlock<T> {};
+
+  /** Fixed-sized Eigen matrices are streamed in the order of their elements in memory. */
+  template<typename T, int ROWS, int COLS, int OPTIONS>
+  struct IsBinaryBlock<Eigen::Matrix<T, ROWS, COLS, OPTIONS, ROWS, COLS>>
+    : std::integral_constant<bool, IsBinaryBlock<T>::value && ROWS != Eigen::Dynamic && COLS != Eigen::Dynamic &&
+                                   sizeof(Eigen::Matrix<T, ROWS, COLS, OPTIONS, ROWS, COLS>) == sizeof(T) * ROWS * COLS> {};
+
+  /** Two dimensional Eigen arrays are streamed as x and y. */
+  template<typename T, int OPTIONS>
+  struct IsBinaryBlock<Eigen::Array<T, 2, 1, OPTIONS, 2, 1>>
+    : std::integral_constant<bool, IsBinaryBlock<T>::value && sizeof(Eigen::Array<T, 2, 1, OPTIONS, 2, 1>) == sizeof(T) * 2> {};
+
+  /** Eigen quaternions are streamed as x, y, z, and w, which is also their order in memory. */
+  template<typename T, int OPTIONS>
+  struct IsBinaryBlock<Eigen::Quaternion<T, OPTIONS>>
+    : std::integral_constant<bool, IsBinaryBlock<T>::value && sizeof(Eigen::Quaternion<T, OPTIONS>) == sizeof(T) * 4> {};
+}
+
 /**
  * Register an Eigen matrix row.
  * @tparam T The type of the elements.
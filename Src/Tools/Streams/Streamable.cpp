@@ -1,6 +1,9 @@
 #include "Streamable.h"
+#include "Tools/Math/Angle.h"
 #include <cstring>
 
+static_assert(sizeof(Angle) == sizeof(float), "Angles are streamed as floats, also as blocks");
+
 void Streamable::streamOut(Out& out) const
 {
   const_cast<Streamable*>(this)->serialize(nullptr, &out);
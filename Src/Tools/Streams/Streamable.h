@@ -11,7 +11,9 @@
 #pragma once
 
 #include <array>
+#include <cstring>
 #include <list>
+#include <type_traits>
 #include <vector>
 #include "InOut.h"
 #include "TypeRegistry.h"
@@ -119,6 +121,21 @@ Out& operator<<(Out& out, const Streamable& streamable);
 
 namespace Streaming
 {
+  /**
+   * Determines whether a type is written to binary streams exactly as it is laid out
+   * in memory. Binary streams read and write arrays of such types as a single block.
+   * Specializations for further types are located next to their streaming operators.
+   * @tparam T The type.
+   */
+  template<typename T> struct IsBinaryBlock : std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value> {};
+
+  /** Angles are streamed as floats. */
+  template<> struct IsBinaryBlock<Angle> : std::true_type {};
+
+  /** Arrays are streamed as their elements. */
+  template<typename E, size_t N> struct IsBinaryBlock<E[N]> : IsBinaryBlock<E> {};
+  template<typename E, size_t N> struct IsBinaryBlock<std::array<E, N>> : std::integral_constant<bool, IsBinaryBlock<E>::value && sizeof(std::array<E, N>) == sizeof(E) * N> {};
+
   template<typename T>
   In& streamComplexStaticArray(In& in, T inArray[], size_t size, const char* enumType)
   {
@@ -188,9 +205,21 @@ namespace Streaming
   In& streamStaticArray(In& in, double inArray[], size_t size, const char* enumType);
   Out& streamStaticArray(Out& out, double outArray[], size_t size, const char* enumType) ;
   template<typename T>
-  In& streamStaticArray(In& in, T inArray[], size_t size, const char* enumType) {return streamComplexStaticArray(in, inArray, size, enumType);}
+  In& streamStaticArray(In& in, T inArray[], size_t size, const char* enumType)
+  {
+    if(IsBinaryBlock<T>::value)
+      return streamBasicStaticArray(in, inArray, size, enumType);
+    else
+      return streamComplexStaticArray(in, inArray, size, enumType);
+  }
   template<typename T>
-  Out& streamStaticArray(Out& out, T outArray[], size_t size, const char* enumType) {return streamComplexStaticArray(out, outArray, size, enumType);}
+  Out& streamStaticArray(Out& out, T outArray[], size_t size, const char* enumType)
+  {
+    if(IsBinaryBlock<T>::value)
+      return streamBasicStaticArray(out, outArray, size, enumType);
+    else
+      return streamComplexStaticArray(out, outArray, size, enumType);
+  }
 
   template<typename T, typename U> void cast(T& t, const U& u) {t = static_cast<T>(u);}
 
@@ -201,16 +230,24 @@ namespace Streaming
     static void stream(In* in, Out* out, const char* name, S& s)
     {
       const char* enumType = std::is_enum<S>::value ? typeid(S).name() : nullptr;
+      // Composite types that are streamed as they are laid out in memory are read and written as a single block.
+      constexpr bool isCompositeBlock = IsBinaryBlock<S>::value && !std::is_arithmetic<S>::value && !std::is_same<S, Angle>::value;
       if(in)
       {
         in->select(name, -2, enumType);
-        *in >> s;
+        if(isCompositeBlock && in->isBinary())
+          in->read(&s, sizeof(S));
+        else
+          *in >> s;
         in->deselect();
       }
       else
       {
         out->select(name, -2, enumType);
-        *out << s;
+        if(isCompositeBlock && out->isBinary())
+          out->write(&s, sizeof(S));
+        else
+          *out << s;
         out->deselect();
       }
     }
@@ -385,6 +422,145 @@ namespace Streaming
     Streamer<S>::stream(nullptr, &out, skipDot(name), const_cast<S&>(s));
   }
 
+  /**
+   * Writes and reads values to and from binary streams without names and selections,
+   * but in exactly the same format as streamIt. This is used by the serialize methods
+   * that STREAMABLE generates. Types that are streamed as they are laid out in memory
+   * are copied as a single block.
+   * @tparam S The type of the value.
+   */
+  template<typename S> struct BinaryStreamer
+  {
+    static void write(Out& out, const S& s)
+    {
+      if(IsBinaryBlock<S>::value)
+        out.write(&s, sizeof(S));
+      else
+        out << s;
+    }
+
+    static void read(In& in, S& s)
+    {
+      if(IsBinaryBlock<S>::value)
+        in.read(&s, sizeof(S));
+      else
+        in >> s;
+    }
+  };
+
+  template<typename S> void writeBinary(Out& out, const S& s) {BinaryStreamer<S>::write(out, s);}
+  template<typename S> void readBinary(In& in, S& s) {BinaryStreamer<S>::read(in, s);}
+
+  template<typename E, size_t N> struct BinaryStreamer<E[N]>
+  {
+    static void write(Out& out, const E(&s)[N])
+    {
+      if(IsBinaryBlock<E>::value)
+        out.write(s, sizeof(s));
+      else
+        for(const E& e : s)
+          writeBinary(out, e);
+    }
+
+    static void read(In& in, E(&s)[N])
+    {
+      if(IsBinaryBlock<E>::value)
+        in.read(s, sizeof(s));
+      else
+        for(E& e : s)
+          readBinary(in, e);
+    }
+  };
+
+  template<typename E, size_t N> struct BinaryStreamer<std::array<E, N>>
+  {
+    static void write(Out& out, const std::array<E, N>& s)
+    {
+      if(IsBinaryBlock<E>::value)
+        out.write(s.data(), N * sizeof(E));
+      else
+        for(const E& e : s)
+          writeBinary(out, e);
+    }
+
+    static void read(In& in, std::array<E, N>& s)
+    {
+      if(IsBinaryBlock<E>::value)
+        in.read(s.data(), N * sizeof(E));
+      else
+        for(E& e : s)
+          readBinary(in, e);
+    }
+  };
+
+  template<typename E, typename A> struct BinaryStreamer<std::vector<E, A>>
+  {
+    static void write(Out& out, const std::vector<E, A>& s)
+    {
+      out << static_cast<unsigned>(s.size());
+      if(IsBinaryBlock<E>::value)
+      {
+        if(!s.empty())
+          out.write(s.data(), s.size() * sizeof(E));
+      }
+      else
+        for(const E& e : s)
+          writeBinary(out, e);
+    }
+
+    static void read(In& in, std::vector<E, A>& s)
+    {
+      unsigned size;
+      in >> size;
+      s.resize(size);
+      if(IsBinaryBlock<E>::value)
+      {
+        if(!s.empty())
+          in.read(s.data(), s.size() * sizeof(E));
+      }
+      else
+        for(E& e : s)
+          readBinary(in, e);
+    }
+  };
+
+  template<typename E, typename A> struct BinaryStreamer<std::list<E, A>>
+  {
+    static void write(Out& out, const std::list<E, A>& s)
+    {
+      out << static_cast<unsigned>(s.size());
+      for(const E& e : s)
+        writeBinary(out, e);
+    }
+
+    static void read(In& in, std::list<E, A>& s)
+    {
+      unsigned size;
+      in >> size;
+      s.resize(size);
+      for(E& e : s)
+        readBinary(in, e);
+    }
+  };
+
+  /**
+   * Copies a value that is streamed as a block to and from a buffer, which is
+   * written or read at once.
+   * @param pos The current position in the buffer. It is advanced by the size of the value.
+   * @param s The value.
+   */
+  template<typename S> void packBinary(char*& pos, const S& s)
+  {
+    std::memcpy(pos, static_cast<const void*>(&s), sizeof(S));
+    pos += sizeof(S);
+  }
+
+  template<typename S> void unpackBinary(const char*& pos, S& s)
+  {
+    std::memcpy(static_cast<void*>(&s), pos, sizeof(S));
+    pos += sizeof(S);
+  }
+
   /**
    * Together with decltype, the following template allows to use any type
    * for declarations, even array types such as int[4]. It also works with
@@ -11,7 +11,8 @@
 
 #include "TypeInfo.h"
 #include "TypeRegistry.h"
-#include <regex>
+#include <cctype>
+#include <cstring>
 
 static const unsigned unifiedTypeNames = 0x80000000;
 
@@ -21,6 +22,12 @@ TypeInfo::TypeInfo(bool fromTypeRegistry)
     TypeRegistry::fill(*this);
 }
 
+const TypeInfo& TypeInfo::getCurrent()
+{
+  static const TypeInfo typeInfo;
+  return typeInfo;
+}
+
 bool TypeInfo::areTypesEqual(const TypeInfo& other, const std::string& thisType, const std::string& otherType) const
 {
   bool thisIsStaticArray = !thisType.empty() && thisType.back() == ']';
@@ -111,20 +118,56 @@ Out& operator<<(Out& out, const TypeInfo& typeInfo)
   return out;
 }
 
+/**
+ * Replaces all occurrences of a string by another one.
+ * @param type The string in which the replacements take place.
+ * @param from The string that is searched for.
+ * @param to The replacement.
+ */
+static void replace(std::string& type, const char* from, const char* to)
+{
+  const size_t fromLength = std::strlen(from);
+  for(size_t pos = type.find(from); pos != std::string::npos; pos = type.find(from, pos))
+  {
+    type.replace(pos, fromLength, to);
+    pos += std::strlen(to);
+  }
+}
+
+/**
+ * Unifies type names from type information that was streamed before type names were
+ * unified when creating it. The replacements were formerly done with the regular expressions
+ * "::__1\b", "([0-9][0-9]*)ul\b", ", ", " >", " \[", and " *\(\*\)".
+ * @param type The type name that is unified.
+ */
 static void demangle(std::string& type)
 {
-  static std::regex matchAnonymousNamespace("::__1\\b");
-  static std::regex matchUnsignedLong("([0-9][0-9]*)ul\\b");
-  static std::regex matchComma(", ");
-  static std::regex matchAngularBracket(" >");
-  static std::regex matchBracket(" \\[");
-  static std::regex matchAsterisk(" *\\(\\*\\)");
-  type = std::regex_replace(type, matchAnonymousNamespace, "");
-  type = std::regex_replace(type, matchUnsignedLong, "$1");
-  type = std::regex_replace(type, matchComma, ",");
-  type = std::regex_replace(type, matchAngularBracket, ">");
-  type = std::regex_replace(type, matchBracket, "[");
-  type = std::regex_replace(type, matchAsterisk, "");
+  auto isWordChar = [](char c) {return std::isalnum(static_cast<unsigned char>(c)) || c == '_';};
+
+  for(size_t pos = type.find("::__1"); pos != std::string::npos; pos = type.find("::__1", pos))
+    if(pos + 5 == type.size() || !isWordChar(type[pos + 5]))
+      type.erase(pos, 5);
+    else
+      ++pos;
+
+  for(size_t pos = type.find("ul"); pos != std::string::npos; pos = type.find("ul", pos))
+    if(pos && std::isdigit(static_cast<unsigned char>(type[pos - 1])) && (pos + 2 == type.size() || !isWordChar(type[pos + 2])))
+      type.erase(pos, 2);
+    else
+      ++pos;
+
+  replace(type, ", ", ",");
+  replace(type, " >", ">");
+  replace(type, " [", "[");
+
+  for(size_t pos = type.find("(*)"); pos != std::string::npos; pos = type.find("(*)", pos))
+  {
+    size_t begin = pos;
+    while(begin && type[begin - 1] == ' ')
+      --begin;
+    type.erase(begin, pos + 3 - begin);
+    pos = begin;
+  }
 }
 
 In& operator>>(In& in, TypeInfo& typeInfo)
@@ -58,6 +58,14 @@ struct TypeInfo
    */
   TypeInfo(bool fromTypeRegistry = true);
 
+  /**
+   * Returns the type information of this executable. It is created from the type
+   * registry when it is requested for the first time, i.e. all types must have been
+   * registered before. Using it avoids demangling all type names again.
+   * @return The type information that is shared by all threads.
+   */
+  static const TypeInfo& getCurrent();
+
   /**
    * Checks whether a type for another type information is deeply equal to
    * a type for this type information.
@@ -16,8 +16,8 @@
 #include <cxxabi.h>
 #endif
 #include <iostream>
+#include <cstring>
 #include <list>
-#include <regex>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -153,34 +153,177 @@ int TypeRegistry::getEnumValue(const char* enumeration, const std::string& name)
   return -1;
 }
 
-#ifdef WINDOWS
-static std::regex matchClass("\\bclass ");
-static std::regex matchEnum("\\benum ");
-static std::regex matchStruct("\\bstruct ");
-static std::regex matchUnion("\\bunion ");
-static std::regex matchInt64("\\b__int64\\b");
-#else
-static std::regex matchAnonymousNamespace("::__1\\b");
-static std::regex matchCXX11Namespace("::__cxx11\\b");
-static std::regex matchNumberSuffix("\\b([0-9][0-9]*)[ul]l*\\b");
-static std::regex matchComma(", ");
+/**
+ * The following functions unify type names. They replace the regular expressions that were
+ * used before, because these were slow. Therefore, they yield exactly the same results,
+ * even where the regular expressions did not handle nested types well.
+ */
+
+/** Can a character be part of a word in the sense of the regular expression "\b"? */
+static bool isWordChar(char c)
+{
+  return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+/**
+ * Replaces all occurrences of a string by another one.
+ * @param type The string in which the replacements take place.
+ * @param from The string that is searched for.
+ * @param to The replacement.
+ * @param wordBefore The string must not follow a word character.
+ * @param wordAfter The string must not be followed by a word character.
+ */
+static void replace(std::string& type, const char* from, const char* to, bool wordBefore = false, bool wordAfter = false)
+{
+  const size_t fromLength = std::strlen(from);
+  std::string result;
+  size_t copied = 0;
+  for(size_t pos = type.find(from); pos != std::string::npos; pos = type.find(from, pos))
+    if((!wordBefore || !pos || !isWordChar(type[pos - 1]))
+       && (!wordAfter || pos + fromLength == type.size() || !isWordChar(type[pos + fromLength])))
+    {
+      result.append(type, copied, pos - copied).append(to);
+      copied = pos += fromLength;
+    }
+    else
+      ++pos;
+  if(copied)
+    type = result.append(type, copied, std::string::npos);
+}
+
+#ifndef WINDOWS
+/** Removes suffixes such as "ul" from numbers (regular expression "\b([0-9][0-9]*)[ul]l*\b"). */
+static void removeNumberSuffixes(std::string& type)
+{
+  std::string result;
+  result.reserve(type.size());
+  for(size_t i = 0; i < type.size();)
+    if(std::isdigit(static_cast<unsigned char>(type[i])) && (!i || !isWordChar(type[i - 1])))
+    {
+      size_t j = i;
+      while(j < type.size() && std::isdigit(static_cast<unsigned char>(type[j])))
+        ++j;
+      result.append(type, i, j - i);
+      if(j < type.size() && (type[j] == 'u' || type[j] == 'l'))
+      {
+        size_t k = j + 1;
+        while(k < type.size() && type[k] == 'l')
+          ++k;
+        if(k == type.size() || !isWordChar(type[k]))
+          j = k;
+      }
+      i = j;
+    }
+    else
+      result += type[i++];
+  type.swap(result);
+}
 #endif
-static std::regex matchAngularBracket(" >");
-static std::regex matchBracket(" \\[");
-static std::regex matchAsterisk(" *\\(\\*[^)]*\\)");
-static std::regex matchString("std::basic_string<char,std::char_traits<char>,std::allocator<char>>");
-static std::regex matchArray("std::array<(.*),([0-9][0-9]*)>");
-static std::regex matchList("std::list<(.*),std::allocator<\\1>>");
-static std::regex matchVector("std::vector<(.*),(std::allocator|Eigen::aligned_allocator)<\\1>>");
+
+/** Removes function pointer parts (regular expression " *\(\*[^)]*\)"). */
+static void removeFunctionPointers(std::string& type)
+{
+  std::string result;
+  result.reserve(type.size());
+  for(size_t i = 0; i < type.size();)
+  {
+    size_t j = i;
+    while(j < type.size() && type[j] == ' ')
+      ++j;
+    const size_t end = type.compare(j, 2, "(*") ? std::string::npos : type.find(')', j + 2);
+    if(end != std::string::npos)
+      i = end + 1;
+    else
+      result += type[i++];
+  }
+  type.swap(result);
+}
+
+/**
+ * Replaces std::array<T,N> by T[N] (regular expression "std::array<(.*),([0-9][0-9]*)>").
+ * @return Was anything replaced?
+ */
+static bool replaceArrays(std::string& type)
+{
+  static const std::string prefix = "std::array<";
+  std::string result;
+  size_t copied = 0;
+  for(size_t pos = type.find(prefix); pos != std::string::npos; pos = type.find(prefix, pos + 1))
+  {
+    // (.*) is greedy, so the last ",<digits>>" is used.
+    const size_t begin = pos + prefix.size();
+    size_t comma = type.size();
+    size_t end = std::string::npos;
+    while(end == std::string::npos && comma > begin && (comma = type.rfind(',', comma - 1)) != std::string::npos && comma >= begin)
+    {
+      size_t i = comma + 1;
+      while(i < type.size() && std::isdigit(static_cast<unsigned char>(type[i])))
+        ++i;
+      if(i > comma + 1 && i < type.size() && type[i] == '>')
+        end = i;
+    }
+    if(end == std::string::npos)
+      break; // Later matches could only use the same commas.
+    result.append(type, copied, pos - copied).append(type, begin, comma - begin)
+      .append("[").append(type, comma + 1, end - comma - 1).append("]");
+    copied = end + 1;
+    pos = end;
+  }
+  if(!copied)
+    return false;
+  type = result.append(type, copied, std::string::npos);
+  return true;
+}
+
+/**
+ * Replaces containers with allocators by T* (regular expressions such as
+ * "std::vector<(.*),(std::allocator|Eigen::aligned_allocator)<\1>>").
+ * @param type The type name.
+ * @param prefix The beginning of the container type, e.g. "std::vector<".
+ * @param allocators The names of the allocators that are accepted, followed by nullptr.
+ * @return Was anything replaced?
+ */
+static bool replaceContainers(std::string& type, const std::string& prefix, const char* const* allocators)
+{
+  std::string result;
+  size_t copied = 0;
+  for(size_t pos = type.find(prefix); pos != std::string::npos; pos = type.find(prefix, pos + 1))
+  {
+    // (.*) is greedy, so the longest element type that matches is used.
+    const size_t begin = pos + prefix.size();
+    size_t end = std::string::npos;
+    size_t length = type.size() - begin + 1;
+    while(end == std::string::npos && length-- > 0)
+      if(begin + length < type.size() && type[begin + length] == ',')
+        for(const char* const* allocator = allocators; *allocator && end == std::string::npos; ++allocator)
+        {
+          size_t i = begin + length + 1;
+          const size_t allocatorLength = std::strlen(*allocator);
+          if(!type.compare(i, allocatorLength, *allocator) && (i += allocatorLength) < type.size() && type[i] == '<'
+             && !type.compare(i + 1, length, type, begin, length) && !type.compare(i + 1 + length, 2, ">>"))
+            end = i + 1 + length + 2;
+        }
+    if(end != std::string::npos)
+    {
+      result.append(type, copied, pos - copied).append(type, begin, length).append("*");
+      copied = end;
+      pos = end - 1;
+    }
+  }
+  if(!copied)
+    return false;
+  type = result.append(type, copied, std::string::npos);
+  return true;
+}
 
 std::string TypeRegistry::demangle(std::string type)
 {
 #ifdef WINDOWS
-  type = std::regex_replace(type, matchClass, "");
-  type = std::regex_replace(type, matchEnum, "");
-  type = std::regex_replace(type, matchStruct, "");
-  type = std::regex_replace(type, matchUnion, "");
-  type = std::regex_replace(type, matchInt64, "long long");
+  replace(type, "class ", "", true);
+  replace(type, "enum ", "", true);
+  replace(type, "struct ", "", true);
+  replace(type, "union ", "", true);
+  replace(type, "__int64", "long long", true, true);
 #else
   int status;
   size_t length;
@@ -191,26 +334,28 @@ std::string TypeRegistry::demangle(std::string type)
   {
     type = buffer;
     std::free(buffer);
-    type = std::regex_replace(type, matchAnonymousNamespace, "");
-    type = std::regex_replace(type, matchCXX11Namespace, "");
-    type = std::regex_replace(type, matchNumberSuffix, "$1");
-    type = std::regex_replace(type, matchComma, ",");
+    replace(type, "::__1", "", false, true);
+    replace(type, "::__cxx11", "", false, true);
+    removeNumberSuffixes(type);
+    replace(type, ", ", ",");
   }
 #endif
 
-  type = std::regex_replace(type, matchAngularBracket, ">");
-  type = std::regex_replace(type, matchBracket, "[");
-  type = std::regex_replace(type, matchAsterisk, "");
-  type = std::regex_replace(type, matchString, "std::string");
-  std::string oldType;
+  replace(type, " >", ">");
+  replace(type, " [", "[");
+  removeFunctionPointers(type);
+  replace(type, "std::basic_string<char,std::char_traits<char>,std::allocator<char>>", "std::string");
+
+  static const char* const listAllocators[] = {"std::allocator", nullptr};
+  static const char* const vectorAllocators[] = {"std::allocator", "Eigen::aligned_allocator", nullptr};
+  bool replaced;
   do
   {
-    oldType = type;
-    type = std::regex_replace(type, matchArray, "$1[$2]");
-    type = std::regex_replace(type, matchList, "$1*");
-    type = std::regex_replace(type, matchVector, "$1*");
+    replaced = replaceArrays(type);
+    replaced |= replaceContainers(type, "std::list<", listAllocators);
+    replaced |= replaceContainers(type, "std::vector<", vectorAllocators);
   }
-  while(oldType != type);
+  while(replaced);
 
   return type;
 }
@@ -239,12 +384,22 @@ void TypeRegistry::print()
 
 void TypeRegistry::fill(TypeInfo& typeInfo)
 {
+  // Most attribute types are used many times, so each is only demangled once.
+  std::unordered_map<const char*, std::string> demangled;
+  auto demangleOnce = [&demangled](const char* type) -> const std::string&
+  {
+    auto i = demangled.find(type);
+    if(i == demangled.end())
+      i = demangled.emplace(type, demangle(type)).first;
+    return i->second;
+  };
+
   for(const char* primitive : primitives)
-    typeInfo.primitives.insert(demangle(primitive));
+    typeInfo.primitives.insert(demangleOnce(primitive));
 
   for(const auto& enumeration : enums)
   {
-    std::vector<std::string>& constants = typeInfo.enums[demangle(enumeration.first)];
+    std::vector<std::string>& constants = typeInfo.enums[demangleOnce(enumeration.first)];
     constants.reserve(enumeration.second.byOrder.size());
     for(const std::string& constant : enumeration.second.byOrder)
       constants.emplace_back(constant);
@@ -252,13 +407,13 @@ void TypeRegistry::fill(TypeInfo& typeInfo)
 
   for(const auto& theClass : classes)
   {
-    std::vector<TypeInfo::Attribute>& attributes = typeInfo.classes[demangle(theClass.first)];
+    std::vector<TypeInfo::Attribute>& attributes = typeInfo.classes[demangleOnce(theClass.first)];
     std::list<const char*> hierarchy;
     hierarchy.push_front(theClass.first);
     while(classes[hierarchy.front()].base)
       hierarchy.push_front(classes[hierarchy.front()].base);
     for(const auto& entry : hierarchy)
       for(const auto& attribute : classes[entry].attributes)
-        attributes.emplace_back(demangle(attribute.type), attribute.name);
+        attributes.emplace_back(demangleOnce(attribute.type), attribute.name);
   }
 }
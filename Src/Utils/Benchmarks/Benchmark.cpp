@@ -0,0 +1,305 @@
+/**
+ * @file Utils/Benchmarks/Benchmark.cpp
+ *
+ * This file implements a class that runs perception modules on the frames of a
+ * log file and measures how long they take.
+ */
+
+#include "Benchmark.h"
+#include "Modules/Infrastructure/LogDataProvider/LogDataProvider.h"
+#include "Platform/BHAssert.h"
+#include "Tools/Global.h"
+#include "Tools/Logging/LoggingTools.h"
+#include "Tools/Module/ModuleGraphCreator.h"
+#include "Tools/Streams/InStreams.h"
+#include "Tools/Streams/OutStreams.h"
+
+#include <algorithm>
+#include <iostream>
+#include <snappy-c.h>
+
+Benchmark::Benchmark(const std::string& threadName) :
+  ThreadFrame(nullptr, nullptr),
+  threadName(threadName),
+  moduleGraphRunner(1)
+{
+  setGlobals();
+  log.setSize(0xfffffffff); // max. 64 GB
+}
+
+bool Benchmark::open(const std::string& fileName)
+{
+  InBinaryFile file(fileName);
+  if(!file.exists())
+    return false;
+
+  // Use the configuration of the robot that recorded the log file.
+  Settings& settings = Global::getSettings();
+  settings.headName = settings.bodyName = "Default";
+  LoggingTools::parseName(fileName, nullptr, &settings.headName, &settings.bodyName,
+                          &settings.scenario, &settings.location, nullptr, &settings.playerNumber);
+
+  char magicByte;
+  file >> magicByte;
+  if(magicByte == LoggingTools::logFileMessageIDs)
+  {
+    log.readMessageIDMapping(file);
+    file >> magicByte;
+  }
+  if(magicByte == LoggingTools::logFileTypeInfo)
+  {
+    typeInfo = std::make_unique<TypeInfo>(false);
+    file >> *typeInfo;
+    file >> magicByte;
+  }
+
+  if(magicByte == LoggingTools::logFileUncompressed)
+    file >> log;
+  else if(magicByte == LoggingTools::logFileCompressed)
+  {
+    std::vector<char> compressedBuffer;
+    std::vector<char> uncompressedBuffer;
+    while(!file.eof())
+    {
+      unsigned compressedSize;
+      file >> compressedSize;
+      compressedBuffer.resize(compressedSize);
+      file.read(compressedBuffer.data(), compressedSize);
+      size_t uncompressedSize;
+      if(snappy_uncompressed_length(compressedBuffer.data(), compressedBuffer.size(), &uncompressedSize) != SNAPPY_OK)
+        return false;
+      uncompressedBuffer.resize(uncompressedSize);
+      if(snappy_uncompress(compressedBuffer.data(), compressedBuffer.size(), uncompressedBuffer.data(), &uncompressedSize) != SNAPPY_OK)
+        return false;
+      InBinaryMemory stream(uncompressedBuffer.data(), uncompressedSize);
+      stream >> log;
+    }
+  }
+  else
+    return false;
+
+  // Remember which representations the log file contains.
+  scanning = true;
+  log.handleAllMessages(*this);
+  scanning = false;
+  return true;
+}
+
+bool Benchmark::select(const std::vector<std::string>& moduleNames)
+{
+  Configuration threads;
+  InMapFile stream("threads.cfg");
+  if(!stream.exists())
+  {
+    OUTPUT_ERROR("Benchmark: Cannot open the file threads.cfg.");
+    return false;
+  }
+  stream >> threads;
+  const auto thread = std::find(threads().begin(), threads().end(), threadName);
+  if(thread == threads().end())
+  {
+    OUTPUT_ERROR("Benchmark: Thread " << threadName << " is unknown.");
+    return false;
+  }
+
+  std::unordered_map<std::string, const ModuleBase*> modules;
+  for(const ModuleBase* i = ModuleBase::first; i; i = i->next)
+    modules.emplace(i->name, i);
+  const ModuleBase* logDataProvider = modules["LogDataProvider"];
+  const auto provides = [](const ModuleBase* module, const std::string& representation)
+  {
+    for(const ModuleBase::Info& info : module->getModuleInfo())
+      if(info.update && representation == info.representation)
+        return true;
+    return false;
+  };
+
+  Configuration config;
+  config().emplace_back();
+  config()[0].name = threadName;
+  std::vector<Configuration::RepresentationProvider>& providers = config()[0].representationProviders;
+  std::unordered_set<std::string> provided;
+  std::vector<std::string> required;
+  const auto use = [&](const std::string& representation, const ModuleBase* module)
+  {
+    providers.emplace_back(representation, module->name);
+    provided.insert(representation);
+    for(const ModuleBase::Info& info : module->getModuleInfo())
+      if(!info.update)
+        required.emplace_back(info.representation);
+  };
+
+  // The modules benchmarked provide what they provide in the thread.
+  for(const std::string& name : moduleNames)
+  {
+    const auto module = modules.find(name);
+    if(module == modules.end())
+    {
+      OUTPUT_ERROR("Benchmark: Module " << name << " is unknown.");
+      return false;
+    }
+    const size_t numOfProviders = providers.size();
+    for(const Configuration::RepresentationProvider& rp : thread->representationProviders)
+      if(rp.provider == name)
+      {
+        use(rp.representation, module->second);
+        stopwatches.emplace_back(rp.representation);
+      }
+    if(providers.size() == numOfProviders)
+    {
+      OUTPUT_ERROR("Benchmark: " << name << " provides nothing in thread " << threadName << ".");
+      return false;
+    }
+  }
+
+  // Their inputs are replayed if possible. Perception modules and the configuration
+  // data provider compute the others. Camera images from the log file are only
+  // available through the LogDataProvider, which also provides the other
+  // infrastructure. Whatever is left is provided by default.
+  while(!required.empty())
+  {
+    const std::string representation = required.back();
+    required.pop_back();
+    if(provided.count(representation))
+      continue;
+
+    const ModuleBase* provider = nullptr;
+    const auto rp = std::find_if(thread->representationProviders.begin(), thread->representationProviders.end(),
+                                 [&](const Configuration::RepresentationProvider& rp) {return rp.representation == representation;});
+    if(logged.count(representation) && provides(logDataProvider, representation))
+      provider = logDataProvider;
+    else if(rp != thread->representationProviders.end() && modules.count(rp->provider)
+            && (modules[rp->provider]->category == ModuleBase::perception || rp->provider == "ConfigurationDataProvider"))
+      provider = modules[rp->provider];
+    else if(provides(logDataProvider, representation))
+      provider = logDataProvider;
+
+    if(provider)
+      use(representation, provider);
+    else
+    {
+      config.defaultRepresentations.emplace_back(representation);
+      provided.insert(representation);
+    }
+  }
+
+  ModuleGraphCreator moduleGraphCreator(config);
+  OutBinaryMemory out(20000);
+  out << config;
+  InBinaryMemory in(out.data());
+  if(!moduleGraphCreator.update(in))
+    return false;
+
+  OutBinaryMemory request(20000);
+  const unsigned timestamp = 0xffffffff;
+  request << moduleGraphCreator.getExecutionValues(0) << timestamp;
+  InBinaryMemory requestStream(request.data());
+  moduleGraphRunner.update(requestStream);
+  return true;
+}
+
+int Benchmark::run()
+{
+  // Like in the framework, the modules are executed once before they receive data.
+  execute();
+  measurements.clear();
+  frames = 0;
+
+  if(typeInfo)
+  {
+    MessageQueue queue;
+    queue.setSize(1000000);
+    queue.out.bin << *typeInfo;
+    queue.out.finishMessage(idTypeInfo);
+    queue.handleAllMessages(*this);
+  }
+
+  inFrame = false;
+  log.handleAllMessages(*this);
+  return frames;
+}
+
+std::vector<std::pair<std::string, Benchmark::Distribution>> Benchmark::getDistributions() const
+{
+  std::vector<std::pair<std::string, Distribution>> distributions;
+  for(const std::string& stopwatch : stopwatches)
+  {
+    Distribution distribution;
+    for(const auto& name : names)
+      if(name.second == stopwatch)
+      {
+        const auto i = measurements.find(name.first);
+        if(i != measurements.end() && !i->second.empty())
+        {
+          std::vector<unsigned> times = i->second;
+          std::sort(times.begin(), times.end());
+          distribution.count = times.size();
+          distribution.median = static_cast<float>(times[times.size() / 2]) / 1000.f;
+          distribution.percentile95 = static_cast<float>(times[times.size() * 95 / 100]) / 1000.f;
+          distribution.maximum = static_cast<float>(times.back()) / 1000.f;
+        }
+        break;
+      }
+    distributions.emplace_back(stopwatch, distribution);
+  }
+  return distributions;
+}
+
+void Benchmark::execute()
+{
+  Global::getTimingManager().signalThreadStart();
+  moduleGraphRunner.execute();
+  Global::getTimingManager().signalThreadStop();
+  ++frames;
+
+  readingTimes = true;
+  Global::getTimingManager().getData().handleAllMessages(*this);
+  readingTimes = false;
+}
+
+bool Benchmark::handleMessage(InMessage& message)
+{
+  if(readingTimes)
+  {
+    // The names of the stopwatches are sent a few per frame.
+    unsigned short count;
+    message.bin >> count;
+    for(unsigned short i = 0; i < count; ++i)
+    {
+      unsigned short id;
+      std::string name;
+      message.bin >> id >> name;
+      names[id] = name;
+    }
+    message.bin >> count;
+    for(unsigned short i = 0; i < count; ++i)
+    {
+      unsigned short id;
+      unsigned time;
+      message.bin >> id >> time;
+      measurements[id].push_back(time);
+    }
+  }
+  else if(scanning)
+  {
+    if(message.getMessageID() == idJPEGImage || message.getMessageID() == idThumbnail)
+      logged.insert("CameraImage");
+    logged.insert(TypeRegistry::getEnumName(message.getMessageID()) + 2);
+  }
+  else if(message.getMessageID() == idFrameBegin)
+  {
+    std::string name;
+    message.bin >> name;
+    inFrame = name == threadName;
+  }
+  else if(message.getMessageID() == idFrameFinished)
+  {
+    if(inFrame)
+      execute();
+    inFrame = false;
+  }
+  else if(message.getMessageID() == idTypeInfo
+          || (inFrame && message.getMessageID() != idStopwatch && message.getMessageID() != idAnnotation))
+    LogDataProvider::handleMessage(message);
+  return true;
+}
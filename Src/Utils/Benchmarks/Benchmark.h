@@ -0,0 +1,111 @@
+/**
+ * @file Utils/Benchmarks/Benchmark.h
+ *
+ * This file declares a class that runs perception modules on the frames of a
+ * log file and measures how long they take.
+ */
+
+#pragma once
+
+#include "Tools/Framework/ThreadFrame.h"
+#include "Tools/Module/ModuleGraphRunner.h"
+#include "Tools/Streams/TypeInfo.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @class Benchmark
+ *
+ * Replays the frames of one thread from a log file. The modules benchmarked
+ * provide what they provide in that thread's configuration. Their inputs are
+ * replayed from the log if it contains them. Otherwise, the other perception
+ * modules and the configuration data provider of the thread compute them.
+ * Everything else is default-constructed. Only the modules selected are
+ * executed, in the thread of the caller.
+ */
+class Benchmark : public ThreadFrame
+{
+public:
+  /** The distribution of all measurements of a stopwatch. */
+  struct Distribution
+  {
+    size_t count = 0; /**< The number of measurements. */
+    float median = 0.f; /**< The median in ms. */
+    float percentile95 = 0.f; /**< The 95th percentile in ms. */
+    float maximum = 0.f; /**< The longest measurement in ms. */
+  };
+
+private:
+  const std::string threadName; /**< The name of the thread whose frames are replayed. */
+  MessageQueue log; /**< The log file. */
+  std::unique_ptr<TypeInfo> typeInfo; /**< The type information of the log file entries, if it contained them. */
+  std::unordered_set<std::string> logged; /**< The names of all representations contained in the log file. */
+  ModuleGraphRunner moduleGraphRunner; /**< Executes the modules. */
+  std::vector<std::string> stopwatches; /**< The stopwatches reported, i.e. the representations provided by the modules benchmarked. */
+  std::unordered_map<unsigned short, std::string> names; /**< The names of the stopwatches of the TimingManager. */
+  std::unordered_map<unsigned short, std::vector<unsigned>> measurements; /**< All measurements per stopwatch in µs. */
+  bool scanning = false; /**< Is the log file scanned for the representations it contains? */
+  bool inFrame = false; /**< Are the messages currently read part of a frame of the thread replayed? */
+  bool readingTimes = false; /**< Are the timing data read rather than log messages? */
+  int frames = 0; /**< The number of frames executed. */
+
+public:
+  /**
+   * Constructor.
+   * @param threadName The name of the thread whose frames are replayed.
+   */
+  Benchmark(const std::string& threadName);
+
+  /**
+   * Reads a log file. The settings are derived from its name.
+   * @param fileName The name of the log file.
+   * @return Could it be read?
+   */
+  bool open(const std::string& fileName);
+
+  /**
+   * Selects the modules benchmarked.
+   * @param modules The names of the modules.
+   * @return Could a module graph be created?
+   */
+  bool select(const std::vector<std::string>& modules);
+
+  /**
+   * Replays all frames of the thread from the log file and executes the modules.
+   * @return The number of frames executed.
+   */
+  int run();
+
+  /**
+   * Returns the distributions of all stopwatches reported.
+   * @return The distribution per representation provided by the modules benchmarked.
+   */
+  std::vector<std::pair<std::string, Distribution>> getDistributions() const;
+
+  /**
+   * Returns the name of the thread whose frames are replayed.
+   * @return The name of the thread.
+   */
+  const std::string& getThreadName() const {return threadName;}
+
+protected:
+  int getPriority() const override {return 0;}
+  void init() override {}
+  bool main() override {return false;}
+  void terminate() override {}
+
+  /**
+   * Handles a message from the log file or from the timing data.
+   * @param message The message.
+   * @return Always true.
+   */
+  bool handleMessage(InMessage& message) override;
+
+private:
+  /** Executes the modules once and records the times they took. */
+  void execute();
+};
@@ -0,0 +1,183 @@
+/**
+ * @file Utils/Benchmarks/Benchmarks.cpp
+ *
+ * Runs perception modules on the frames of a log file, reports the
+ * distributions of their execution times and compares them to a baseline.
+ * The results are written in the format of the console command "bm save".
+ * The program fails if a module got slower than the tolerance allows.
+ */
+
+#include "Benchmark.h"
+#include "Tools/FunctionList.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/** The modules benchmarked if none are specified. */
+static const std::vector<std::string> defaultModules =
+{
+  "ECImageProvider",
+  "CNSImageProvider",
+  "ColorScanLineRegionizer",
+  "FieldBoundaryProvider",
+  "BallSpotsProvider",
+  "BallPerceptor",
+  "LinePerceptor",
+  "PlayersDeeptector"
+};
+
+/**
+ * Reads a baseline written by "bm save" or by this program.
+ * @param name The name of the file.
+ * @param baseline The 95th percentiles per "thread,stopwatch" are stored here.
+ * @return Could the file be read?
+ */
+static bool readBaseline(const std::string& name, std::unordered_map<std::string, float>& baseline)
+{
+  std::ifstream file(name);
+  if(!file.is_open())
+    return false;
+  std::string line;
+  std::getline(file, line);
+  while(std::getline(file, line))
+  {
+    std::vector<std::string> columns;
+    for(std::string::size_type start = 0, end = 0; end != std::string::npos; start = end + 1)
+    {
+      end = line.find(',', start);
+      columns.emplace_back(line.substr(start, end == std::string::npos ? std::string::npos : end - start));
+    }
+    if(columns.size() == 6)
+      baseline[columns[0] + "," + columns[1]] = static_cast<float>(std::atof(columns[4].c_str()));
+  }
+  return true;
+}
+
+/**
+ * Prints how to call this program.
+ * @return The exit code for a wrong call.
+ */
+static int usage()
+{
+  std::cerr << "usage: Benchmarks [-t <thread>] [-b <baseline.csv>] [-o <result.csv>] [-p <tolerance%>] <log> [<module> ...]" << std::endl;
+  return EXIT_FAILURE;
+}
+
+int main(int argc, char** argv)
+{
+  std::string threadName = "Upper";
+  std::string baselineName;
+  std::string resultName;
+  float tolerance = 10.f;
+  std::string logName;
+  std::vector<std::string> modules;
+  for(int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    if(arg == "-t" && i + 1 < argc)
+      threadName = argv[++i];
+    else if(arg == "-b" && i + 1 < argc)
+      baselineName = argv[++i];
+    else if(arg == "-o" && i + 1 < argc)
+      resultName = argv[++i];
+    else if(arg == "-p" && i + 1 < argc)
+      tolerance = static_cast<float>(std::atof(argv[++i]));
+    else if(arg[0] == '-')
+      return usage();
+    else if(logName.empty())
+      logName = arg;
+    else
+      modules.emplace_back(arg);
+  }
+  if(logName.empty())
+    return usage();
+  if(modules.empty())
+    modules = defaultModules;
+
+  // Acquire static data, e.g. about types, before the modules need them
+  FunctionList::execute();
+  Benchmark benchmark(threadName);
+  if(!benchmark.open(logName))
+  {
+    std::cerr << "Benchmarks: Cannot read the log file " << logName << "." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if(!benchmark.select(modules))
+    return EXIT_FAILURE;
+  const int frames = benchmark.run();
+  if(!frames)
+  {
+    std::cerr << "Benchmarks: The log file contains no frames of thread " << threadName << "." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const std::vector<std::pair<std::string, Benchmark::Distribution>> distributions = benchmark.getDistributions();
+  std::cout << frames << " frames of thread " << threadName << ", times in ms" << std::endl;
+  for(const auto& pair : distributions)
+  {
+    char buffer[200];
+    std::snprintf(buffer, sizeof(buffer), "%-32s median %7.3f, 95%% %7.3f, max %7.3f", pair.first.c_str(),
+                  pair.second.median, pair.second.percentile95, pair.second.maximum);
+    std::cout << buffer << std::endl;
+  }
+
+  if(!resultName.empty())
+  {
+    std::ofstream file(resultName);
+    if(!file.is_open())
+    {
+      std::cerr << "Benchmarks: Cannot write " << resultName << "." << std::endl;
+      return EXIT_FAILURE;
+    }
+    file << "thread,stopwatch,count,median,95%,max\n";
+    for(const auto& pair : distributions)
+      file << threadName << "," << pair.first << "," << pair.second.count << "," << pair.second.median << ","
+           << pair.second.percentile95 << "," << pair.second.maximum << "\n";
+  }
+
+  if(baselineName.empty())
+    return EXIT_SUCCESS;
+
+  std::unordered_map<std::string, float> baseline;
+  if(!readBaseline(baselineName, baseline))
+  {
+    std::cerr << "Benchmarks: Cannot read the baseline " << baselineName << "." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Compare the 95th percentiles, because single outliers are not significant.
+  // Stopwatches missing in the baseline are regressions, too, because they cannot be checked.
+  int regressions = 0;
+  for(const auto& pair : distributions)
+  {
+    const auto i = baseline.find(threadName + "," + pair.first);
+    if(i == baseline.end())
+    {
+      std::cerr << threadName << " " << pair.first << ": missing in baseline" << std::endl;
+      ++regressions;
+      continue;
+    }
+    const float percentile95 = pair.second.percentile95;
+    const float change = i->second > 0.f ? (percentile95 / i->second - 1.f) * 100.f : 0.f;
+    const bool regression = change > tolerance || !pair.second.count;
+    regressions += regression ? 1 : 0;
+    char buffer[200];
+    std::snprintf(buffer, sizeof(buffer), "%s %s: %.3f ms -> %.3f ms (%+.1f%%)%s", threadName.c_str(), pair.first.c_str(),
+                  i->second, percentile95, change, regression ? " regression" : "");
+    (regression ? std::cerr : std::cout) << buffer << std::endl;
+  }
+  const std::string summary = std::to_string(regressions) + " of " + std::to_string(distributions.size()) + " stopwatches slower than "
+                              + std::to_string(static_cast<int>(tolerance)) + "% over baseline";
+  if(regressions)
+  {
+    std::cerr << "Error: Benchmarks: " << summary << "." << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << summary << std::endl;
+  return EXIT_SUCCESS;
+}
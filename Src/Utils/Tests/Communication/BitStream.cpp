@@ -0,0 +1,158 @@
+#include "Representations/Communication/BHumanTeamMessageParts/BHumanStandardMessage.h"
+#include "Tools/Communication/BitStream.h"
+#include "Tools/Math/Random.h"
+#include "Utils/Tests/bench.h"
+
+#include "gtest/gtest.h"
+
+#include <SPLStandardMessage.h>
+#include <limits>
+
+#ifndef NDEBUG
+#define RUNS 1000
+#else
+#define RUNS 100000
+#endif
+
+GTEST_TEST(BitStream, roundTrip)
+{
+  char data[64];
+  BitWriter writer(data);
+  writer.writeBits(5, 3);
+  writer.writeBool(true);
+  writer.writeBits(0xDEADBEEF, 32);
+  writer.writeUnsigned(1000, 100);
+  writer.writeSigned(-1, -1, 6);
+  writer.writeSigned(-5000, -32768, 32767);
+  writer.writeQuantized(0.5f, 0.f, 1.f, 8);
+  writer.writeFloat(-1234.5f);
+  writer.writeFloat(0.f);
+  writer.writeFloat(1e20f);
+  const size_t size = writer.finish();
+
+  BitWriter counter;
+  counter.writeBits(5, 3);
+  counter.writeBool(true);
+  counter.writeBits(0xDEADBEEF, 32);
+  counter.writeUnsigned(1000, 100);
+  counter.writeSigned(-1, -1, 6);
+  counter.writeSigned(-5000, -32768, 32767);
+  counter.writeQuantized(0.5f, 0.f, 1.f, 8);
+  counter.writeFloat(-1234.5f);
+  counter.writeFloat(0.f);
+  counter.writeFloat(1e20f);
+  EXPECT_EQ(size, counter.finish());
+  EXPECT_EQ((3 + 1 + 32 + 7 + 3 + 16 + 8 + 3 * 16 + 7) / 8, static_cast<int>(size));
+
+  BitReader reader(data);
+  EXPECT_EQ(5u, reader.readBits(3));
+  EXPECT_TRUE(reader.readBool());
+  EXPECT_EQ(0xDEADBEEF, reader.readBits(32));
+  EXPECT_EQ(100u, reader.readUnsigned(100));
+  EXPECT_EQ(-1, reader.readSigned(-1, 6));
+  EXPECT_EQ(-5000, reader.readSigned(-32768, 32767));
+  EXPECT_NEAR(0.5f, reader.readQuantized(0.f, 1.f, 8), 1.f / 255.f);
+  EXPECT_NEAR(-1234.5f, reader.readFloat(), 1234.5f * 0.001f);
+  EXPECT_EQ(0.f, reader.readFloat());
+  EXPECT_NEAR(2147483648.f, reader.readFloat(), 2147483648.f * 0.001f);
+}
+
+GTEST_TEST(BitStream, reducedFloatPrecision)
+{
+  char data[4];
+  for(int i = 0; i < RUNS; ++i)
+  {
+    const float value = (Random::bernoulli() ? 1.f : -1.f) * std::pow(10.f, Random::uniform(-6.f, 8.f));
+    BitWriter writer(data);
+    writer.writeFloat(value);
+    ASSERT_EQ(2u, writer.finish());
+    BitReader reader(data);
+    EXPECT_NEAR(value, reader.readFloat(), std::abs(value) * 0.001f);
+  }
+}
+
+GTEST_TEST(BitStream, nonFiniteFloats)
+{
+  char data[8];
+  BitWriter writer(data);
+  writer.writeFloat(1e20f);
+  writer.writeFloat(std::numeric_limits<float>::infinity());
+  writer.writeFloat(-std::numeric_limits<float>::infinity());
+  writer.writeFloat(std::numeric_limits<float>::quiet_NaN());
+  ASSERT_EQ(8u, writer.finish());
+
+  // Infinities are clipped to the largest magnitude, NaN is written as 0.
+  BitReader reader(data);
+  const float largest = reader.readFloat();
+  EXPECT_EQ(largest, reader.readFloat());
+  EXPECT_EQ(-largest, reader.readFloat());
+  EXPECT_EQ(0.f, reader.readFloat());
+}
+
+GTEST_TEST(BitStream, standardMessage)
+{
+  BHumanStandardMessage message;
+  message.timestamp = 100000;
+  message.robotPoseDeviation = 123.f;
+  message.robotPoseCovariance = {{ 10000.f, 20.f, 0.1f, 9000.f, 0.2f, 0.05f }};
+  message.ballCovariance = {{ 400.f, 10.f, 300.f }};
+  message.timeWhenReachBall = message.timestamp + 8000;
+  message.timeWhenReachBallStriker = 0xFFFFFFFF;
+  for(int i = 0; i < BHUMAN_STANDARD_MESSAGE_MAX_NUM_OF_OBSTACLES; ++i)
+  {
+    Obstacle obstacle;
+    obstacle.covariance << 40000.f, 100.f, 100.f, 30000.f;
+    obstacle.center = Vector2f(1000.f * i, -500.f * i);
+    obstacle.left = obstacle.center + Vector2f(0.f, 100.f);
+    obstacle.right = obstacle.center - Vector2f(0.f, 100.f);
+    obstacle.lastSeen = message.timestamp - 100 * i;
+    obstacle.type = Obstacle::opponent;
+    message.obstacles.push_back(obstacle);
+  }
+  for(uint8_t receiver = 1; receiver <= 3; ++receiver)
+  {
+    message.ntpMessages.emplace_back();
+    message.ntpMessages.back().receiver = receiver;
+    message.ntpMessages.back().requestOrigination = 99000;
+    message.ntpMessages.back().requestReceipt = 99500;
+  }
+
+  const int size = message.sizeOfBHumanMessage();
+  EXPECT_LT(size, SPL_STANDARD_MESSAGE_DATA_SIZE / 2);
+
+  char data[SPL_STANDARD_MESSAGE_DATA_SIZE];
+  PRINTF("bytes per message with %d obstacles: %d\n", BHUMAN_STANDARD_MESSAGE_MAX_NUM_OF_OBSTACLES, size);
+  PRINTF("encoding: ");
+  RUN_BENCH(10, RUNS, message.write(data));
+
+  // read(const void*) requires the settings, so the header is skipped here.
+  BHumanStandardMessage decoded;
+  const auto decode = [&]
+  {
+    BitReader reader(data);
+    for(size_t i = 0; i < sizeof(message.header) + sizeof(message.version) + sizeof(message.magicNumber); ++i)
+      reader.readBits(8);
+    decoded.read(reader);
+  };
+  PRINTF("decoding: ");
+  RUN_BENCH(10, RUNS, decode());
+
+  EXPECT_EQ(size, decoded.sizeOfBHumanMessage());
+  EXPECT_EQ(message.timestamp, decoded.timestamp);
+  EXPECT_NEAR(message.robotPoseCovariance[0], decoded.robotPoseCovariance[0], message.robotPoseCovariance[0] * 0.001f);
+  EXPECT_EQ(message.timeWhenReachBall, decoded.timeWhenReachBall);
+  EXPECT_EQ(message.timestamp + (0xFFFDu << 3), decoded.timeWhenReachBallStriker);
+  ASSERT_EQ(message.obstacles.size(), decoded.obstacles.size());
+  for(size_t i = 0; i < message.obstacles.size(); ++i)
+  {
+    EXPECT_TRUE(message.obstacles[i].center.isApprox(decoded.obstacles[i].center));
+    EXPECT_NEAR(message.obstacles[i].left.y(), decoded.obstacles[i].left.y(), 4.f);
+    EXPECT_NEAR(message.obstacles[i].covariance(0, 1), decoded.obstacles[i].covariance(0, 1), 0.1f);
+    EXPECT_GE(decoded.obstacles[i].lastSeen, message.obstacles[i].lastSeen);
+    EXPECT_LT(decoded.obstacles[i].lastSeen, message.obstacles[i].lastSeen + 64);
+    EXPECT_EQ(message.obstacles[i].type, decoded.obstacles[i].type);
+  }
+  ASSERT_EQ(message.ntpMessages.size(), decoded.ntpMessages.size());
+  EXPECT_EQ(3, decoded.ntpMessages.back().receiver);
+  EXPECT_EQ(99500u, decoded.ntpMessages.back().requestReceipt);
+}
@@ -0,0 +1,106 @@
+#include "Tools/Debugging/PackedDrawing.h"
+#include "Tools/Streams/InStreams.h"
+#include "Tools/Streams/OutStreams.h"
+
+#include "gtest/gtest.h"
+
+#include <limits>
+#include <vector>
+
+GTEST_TEST(PackedDrawing, keepsElementsInOrder)
+{
+  const ColorRGBA colors[] = {ColorRGBA::gray, ColorRGBA::white, ColorRGBA::black, ColorRGBA::green};
+  PackedDrawing packedDrawing;
+  EXPECT_TRUE(packedDrawing.empty());
+  for(int i = 0; i < 100; ++i)
+  {
+    packedDrawing.addLine(4.f + 8.f * static_cast<float>(i), 479.f, 4.f + 8.f * static_cast<float>(i), 479.f - 3.25f * static_cast<float>(i),
+                          4.f, 1, colors[i % 4]);
+    packedDrawing.addDot(-2000 + 40 * i, 1000 - 20 * i, ColorRGBA::black, colors[(i + 1) % 4]);
+  }
+  packedDrawing.addLine(-100000.f, 100000.f, 100000.f, -100000.f, 0.5f, 2, ColorRGBA(1, 2, 3, 4));
+  EXPECT_FALSE(packedDrawing.empty());
+
+  OutBinaryMemory out(1000);
+  out << packedDrawing;
+  InBinaryMemory in(out.data(), out.size());
+  PackedDrawing received;
+  in >> received;
+  EXPECT_TRUE(in.eof());
+
+  std::vector<PackedDrawing::Element> elements;
+  received.getElements(elements);
+  ASSERT_EQ(201u, elements.size());
+  for(int i = 0; i < 100; ++i)
+  {
+    const PackedDrawing::Element& line = elements[2 * i];
+    EXPECT_EQ(PackedDrawing::Shape::line, line.shape);
+    EXPECT_EQ(4.f + 8.f * static_cast<float>(i), line.x1);
+    EXPECT_EQ(479.f, line.y1);
+    EXPECT_EQ(line.x1, line.x2);
+    EXPECT_EQ(479.f - 3.25f * static_cast<float>(i), line.y2);
+    EXPECT_EQ(4.f, line.width);
+    EXPECT_EQ(1, line.penStyle);
+    EXPECT_EQ(colors[i % 4], line.penColor);
+
+    const PackedDrawing::Element& dot = elements[2 * i + 1];
+    EXPECT_EQ(PackedDrawing::Shape::dot, dot.shape);
+    EXPECT_EQ(static_cast<float>(-2000 + 40 * i), dot.x1);
+    EXPECT_EQ(static_cast<float>(1000 - 20 * i), dot.y1);
+    EXPECT_EQ(ColorRGBA::black, dot.penColor);
+    EXPECT_EQ(colors[(i + 1) % 4], dot.brushColor);
+  }
+  const PackedDrawing::Element& last = elements.back();
+  EXPECT_EQ(-100000.f, last.x1);
+  EXPECT_EQ(100000.f, last.y1);
+  EXPECT_EQ(100000.f, last.x2);
+  EXPECT_EQ(-100000.f, last.y2);
+  EXPECT_EQ(0.5f, last.width);
+  EXPECT_EQ(ColorRGBA(1, 2, 3, 4), last.penColor);
+
+  // As separate messages, the lines would need 31 bytes each and the dots 22 bytes, including the headers.
+  EXPECT_GT(100u * (31u + 22u) / 2u, out.size());
+
+  packedDrawing.clear();
+  EXPECT_TRUE(packedDrawing.empty());
+}
+
+GTEST_TEST(PackedDrawing, quantizesCoordinates)
+{
+  PackedDrawing packedDrawing;
+  packedDrawing.addLine(0.03f, -0.03f, 1.2f, std::numeric_limits<float>::quiet_NaN(), 1.f, 1, ColorRGBA::red);
+  packedDrawing.addLine(1e20f, -std::numeric_limits<float>::infinity(), 0.f, 0.f, 1.f, 1, ColorRGBA::red);
+  std::vector<PackedDrawing::Element> elements;
+  packedDrawing.getElements(elements);
+  ASSERT_EQ(2u, elements.size());
+  EXPECT_EQ(0.f, elements[0].x1);
+  EXPECT_EQ(0.f, elements[0].y1);
+  EXPECT_EQ(1.1875f, elements[0].x2);
+  EXPECT_EQ(0.f, elements[0].y2);
+  EXPECT_LT(1e7f, elements[1].x1);
+  EXPECT_GT(-1e7f, elements[1].y1);
+  EXPECT_EQ(0.f, elements[1].x2);
+  EXPECT_EQ(0.f, elements[1].y2);
+}
+
+GTEST_TEST(PackedDrawing, becomesFullWhenPaletteIsUsedUp)
+{
+  PackedDrawing packedDrawing;
+  int colors = 0;
+  while(!packedDrawing.full())
+  {
+    packedDrawing.addDot(0, 0, ColorRGBA(static_cast<unsigned char>(colors), 0, 0), ColorRGBA(static_cast<unsigned char>(colors + 1), 0, 0));
+    colors += 2;
+  }
+  EXPECT_LE(colors, 255);
+
+  OutBinaryMemory out(2000);
+  out << packedDrawing;
+  InBinaryMemory in(out.data(), out.size());
+  PackedDrawing received;
+  in >> received;
+  std::vector<PackedDrawing::Element> elements;
+  received.getElements(elements);
+  ASSERT_EQ(static_cast<size_t>(colors / 2), elements.size());
+  EXPECT_EQ(ColorRGBA(static_cast<unsigned char>(colors - 1), 0, 0), elements.back().brushColor);
+}
@@ -0,0 +1,55 @@
+#include "Tools/Debugging/PlotBuffer.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+
+GTEST_TEST(PlotBuffer, keepsNewestValues)
+{
+  PlotBuffer buffer(5);
+  EXPECT_TRUE(buffer.empty());
+  for(int i = 0; i < 8; ++i)
+    buffer.push_front(static_cast<float>(i));
+  ASSERT_EQ(5u, buffer.size());
+  for(size_t i = 0; i < buffer.size(); ++i)
+    EXPECT_EQ(static_cast<float>(7 - i), buffer[i]);
+
+  buffer.setCapacity(3);
+  ASSERT_EQ(3u, buffer.size());
+  EXPECT_EQ(7.f, buffer[0]);
+  EXPECT_EQ(5.f, buffer[2]);
+
+  buffer.setCapacity(10);
+  ASSERT_EQ(3u, buffer.size());
+  buffer.push_front(8.f);
+  EXPECT_EQ(8.f, buffer[0]);
+  EXPECT_EQ(5.f, buffer[3]);
+}
+
+GTEST_TEST(PlotBuffer, minMaxLikeAllValues)
+{
+  const size_t capacity = 10000;
+  PlotBuffer buffer(capacity);
+  std::deque<float> expected;
+  std::srand(0);
+  for(size_t i = 0; i < 3 * capacity; ++i)
+  {
+    const float value = static_cast<float>(std::rand() % 2001 - 1000);
+    buffer.push_front(value);
+    expected.push_front(value);
+    if(expected.size() > capacity)
+      expected.pop_back();
+
+    if(i % 997 == 0)
+      for(int j = 0; j < 50; ++j)
+      {
+        const size_t begin = std::rand() % expected.size();
+        const size_t end = begin + 1 + std::rand() % (expected.size() - begin);
+        const PlotBuffer::MinMax minMax = buffer.getMinMax(begin, end);
+        EXPECT_EQ(*std::min_element(expected.begin() + begin, expected.begin() + end), minMax.min);
+        EXPECT_EQ(*std::max_element(expected.begin() + begin, expected.begin() + end), minMax.max);
+      }
+  }
+}
@@ -0,0 +1,41 @@
+#include "Tools/ImageProcessing/CNS/CodedContour.h"
+
+#include "gtest/gtest.h"
+
+#include <random>
+
+static void fillRandomly(CNSImage& cns, std::mt19937& generator)
+{
+  std::uniform_real_distribution<float> distribution(-0.7f, 0.7f);
+  for(unsigned y = 0; y < cns.height; ++y)
+    for(unsigned x = 0; x < cns.width; ++x)
+      cns[y][x] = CNSResponse(distribution(generator), distribution(generator));
+}
+
+GTEST_TEST(CNS, evaluateX32Y16LikeTwoX16Y16)
+{
+  std::mt19937 generator(0);
+  CNSImage cns;
+  fillRandomly(cns, generator);
+
+  for(int r : {6, 12, 24})
+  {
+    CodedContour contour = CodedContour::circle(r);
+    if(r == 12)
+      contour.mapping = LinearResponseMapping(2.0, -0.5, -1.0, 1.0);
+    for(int y = 32; y + 16 + 32 <= static_cast<int>(cns.height); y += 80)
+      for(int x = 32; x + 32 + 32 <= static_cast<int>(cns.width); x += 96)
+      {
+        alignas(16) signed short response32[2][16][16];
+        contour.evaluateX32Y16(response32, cns, x, y);
+        for(int half = 0; half < 2; ++half)
+        {
+          alignas(16) signed short response16[16][16];
+          contour.evaluateX16Y16(response16, cns, x + 16 * half, y);
+          for(int i = 0; i < 16; ++i)
+            for(int j = 0; j < 16; ++j)
+              ASSERT_EQ(response16[i][j], response32[half][i][j]) << "r = " << r << ", x = " << x + 16 * half + j << ", y = " << y + i;
+        }
+      }
+  }
+}
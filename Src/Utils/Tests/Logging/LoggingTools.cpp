@@ -0,0 +1,89 @@
+#include "Tools/Logging/LoggingTools.h"
+#include "Representations/BehaviorControl/ActivationGraph.h"
+#include "Tools/MessageQueue/MessageQueue.h"
+
+#include "gtest/gtest.h"
+
+#include <functional>
+
+namespace
+{
+  class GraphReader : public MessageHandler
+  {
+    std::function<void(const ActivationGraph&)> read;
+    ActivationGraph graph;
+
+    bool handleMessage(InMessage& message) override
+    {
+      EXPECT_EQ(idActivationGraph, message.getMessageID());
+      message.bin >> graph;
+      read(graph);
+      return true;
+    }
+
+  public:
+    GraphReader(const std::function<void(const ActivationGraph&)>& read) : read(read) {}
+  };
+}
+
+static const char* const options[] = {"a", "b", "c", "d", "e", "f"};
+
+// Frame f executes the option options[f / 25] in the state "state".
+static void createLog(MessageQueue& queue, int numOfFrames)
+{
+  queue.setSize(1000000);
+  ActivationGraph graph;
+  for(int frame = 0; frame < numOfFrames; ++frame)
+  {
+    graph.beginFrame();
+    graph.add(options[frame / 25], 0, "state", 0, 0);
+    queue.out.bin << graph;
+    queue.out.finishMessage(idActivationGraph);
+  }
+}
+
+GTEST_TEST(LoggingTools, keepMessagesRestoresOptionNames)
+{
+  MessageQueue queue;
+  createLog(queue, 150);
+
+  // Frame 0 and 100 are key frames. Names are added in the frames 0, 25, 50, 75, and 125.
+  const std::vector<int> keptFrames = {30, 31, 60, 100, 101, 140};
+  const std::vector<const char*> expectedOptions = {"b", "b", "c", "e", "e", "f"};
+  const std::vector<bool> expectedKeyFrames = {true, false, true, true, false, true};
+
+  std::vector<bool> keepMessage(queue.getNumberOfMessages());
+  for(int frame : keptFrames)
+    keepMessage[frame] = true;
+  LoggingTools::keepMessages(queue, keepMessage);
+  ASSERT_EQ(static_cast<int>(keptFrames.size()), queue.getNumberOfMessages());
+
+  size_t i = 0;
+  GraphReader reader([&](const ActivationGraph& graph)
+  {
+    ASSERT_EQ(1u, graph.graph.size());
+    EXPECT_EQ(expectedOptions[i], graph.getName(graph.graph[0].option)) << "frame " << keptFrames[i];
+    EXPECT_EQ("state", graph.getName(graph.graph[0].state)) << "frame " << keptFrames[i];
+    EXPECT_EQ(expectedKeyFrames[i], graph.firstName == 0 && graph.names.size() == graph.nameTable.size()) << "frame " << keptFrames[i];
+    ++i;
+  });
+  queue.handleAllMessages(reader);
+  EXPECT_EQ(keptFrames.size(), i);
+}
+
+GTEST_TEST(LoggingTools, keepMessagesWithoutGapsKeepsGraphs)
+{
+  MessageQueue queue;
+  createLog(queue, 150);
+  const size_t streamedSize = queue.getStreamedSize();
+
+  std::vector<bool> keepMessage(queue.getNumberOfMessages());
+  std::fill(keepMessage.begin(), keepMessage.begin() + 80, true);
+  MessageQueue expected;
+  createLog(expected, 80);
+  LoggingTools::keepMessages(queue, keepMessage);
+
+  ASSERT_EQ(80, queue.getNumberOfMessages());
+  EXPECT_EQ(expected.getStreamedSize(), queue.getStreamedSize());
+  EXPECT_GT(streamedSize, queue.getStreamedSize());
+}
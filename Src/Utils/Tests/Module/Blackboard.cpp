@@ -0,0 +1,40 @@
+#include "Tools/Module/Blackboard.h"
+#include "Tools/Streams/AutoStreamable.h"
+
+#include "gtest/gtest.h"
+
+namespace
+{
+  STREAMABLE(TestRepresentation,
+  {,
+    (int)(42) value,
+  });
+}
+
+GTEST_TEST(Blackboard, slotsAndNamesAccessTheSameRepresentation)
+{
+  Blackboard blackboard;
+  const BlackboardSlot<TestRepresentation>& slot = BlackboardSlot<TestRepresentation>::get("TestRepresentation");
+  EXPECT_EQ(&slot, &BlackboardSlot<TestRepresentation>::get("TestRepresentation"));
+  EXPECT_FALSE(blackboard.exists(slot));
+  EXPECT_FALSE(blackboard.exists("TestRepresentation"));
+
+  TestRepresentation& representation = blackboard.alloc(slot);
+  EXPECT_EQ(&representation, &blackboard.alloc<TestRepresentation>("TestRepresentation"));
+  EXPECT_TRUE(blackboard.exists(slot));
+  EXPECT_EQ(&representation, &blackboard[slot]);
+  EXPECT_EQ(&representation, &blackboard["TestRepresentation"]);
+
+  blackboard.free("TestRepresentation");
+  EXPECT_TRUE(blackboard.exists(slot));
+  blackboard.free(slot);
+  EXPECT_FALSE(blackboard.exists(slot));
+}
+
+#ifndef NDEBUG
+GTEST_TEST(Blackboard, slotOfTypeRequiresTheSameName)
+{
+  BlackboardSlot<TestRepresentation>::get("TestRepresentation");
+  ASSERT_DEATH(BlackboardSlot<TestRepresentation>::get("OtherRepresentation"), "");
+}
+#endif
@@ -45,6 +45,7 @@ struct Parameters
   Configuration config2; // update
   std::vector<std::vector<std::vector<const char*>>> received2;
   std::vector<std::vector<std::vector<const char*>>> sent2;
+  std::vector<std::vector<std::string>> reset; // representations reset per thread by the update
 };
 
 /**
@@ -86,6 +87,7 @@ protected:
 
   const std::vector<std::vector<std::vector<const char*>>>& received() { return moduleGraphCreator.received; }
   const std::vector<std::vector<std::vector<const char*>>>& sent() { return moduleGraphCreator.sent; }
+  const std::vector<std::vector<std::string>>& representationsToReset() { return moduleGraphCreator.representationsToReset; }
 };
 
 using ExpModuleGraphCreatorDeathTest = ModuleGraphCreatorTest;
@@ -9,6 +9,7 @@
 #include "Utils/Tests/ModuleGraphCreator/ModuleGraphCreatorTest.h"
 
 #include <gtest/gtest.h>
+#include <algorithm>
 
 /*
  * Require:
@@ -48,6 +49,21 @@ TEST_P(ModuleGraphCreatorSimple, updateTest)
   ASSERT_DEATH(exit(-1), "^$");
 }
 
+// Only representations whose provider changed in a thread are reset in that thread.
+// Representations no longer provided are only reset if they are provided by default now.
+TEST_P(ModuleGraphCreatorSimple, resetTest)
+{
+  update(GetParam().config);
+  update(GetParam().config2);
+  ASSERT_EQ(GetParam().reset.size(), representationsToReset().size());
+  for(std::size_t i = 0; i < representationsToReset().size(); ++i)
+  {
+    std::vector<std::string> reset = representationsToReset()[i];
+    std::sort(reset.begin(), reset.end());
+    EXPECT_EQ(GetParam().reset[i], reset) << "thread " << i;
+  }
+}
+
 // No communication, change a module.
 INSTANTIATE_TEST_CASE_P(ChangeModule, ModuleGraphCreatorSimple, testing::Values(
   // Provide the same.
@@ -56,7 +72,8 @@ INSTANTIATE_TEST_CASE_P(ChangeModule, ModuleGraphCreatorSimple, testing::Values(
     createConfig({{{"A", "Ac"}, {"B", "Bc"}}}),
     {{{}}}, {{{}}},
     createConfig({{{"A", "Ac"}, {"B", "Cc"}}}),
-    {{{}}}, {{{}}}
+    {{{}}}, {{{}}},
+    {{"B"}} // reset
   },
   // Provide something different.
   Parameters // 1
@@ -64,7 +81,8 @@ INSTANTIATE_TEST_CASE_P(ChangeModule, ModuleGraphCreatorSimple, testing::Values(
     createConfig({{{"A", "Ac"}, {"B", "Bc"}}}),
     {{{}}}, {{{}}},
     createConfig({{{"A", "Ac"}, {"C", "Dc"}}}),
-    {{{}}}, {{{}}}
+    {{{}}}, {{{}}},
+    {{}} // B is not provided anymore, but not by default either
   },
   // Change provider of send data.
   Parameters // 2
@@ -74,7 +92,8 @@ INSTANTIATE_TEST_CASE_P(ChangeModule, ModuleGraphCreatorSimple, testing::Values(
     {{{}, {"B"}}, {{}, {}}}, // sent
     createConfig({{{"A", "Ac"}, {"B", "Cc"}}, {{"A", "Bm"}}}),
     {{{}, {}}, {{"B"}, {}}}, // received
-    {{{}, {"B"}}, {{}, {}}} // sent
+    {{{}, {"B"}}, {{}, {}}}, // sent
+    {{"B"}, {}} // reset
   },
   Parameters // 3
   {
@@ -83,7 +102,8 @@ INSTANTIATE_TEST_CASE_P(ChangeModule, ModuleGraphCreatorSimple, testing::Values(
     {{{}, {}}, {{"B"}, {}}}, // sent
     createConfig({{{"A", "Bm"}}, {{"A", "Ac"}, {"B", "Cc"}}}),
     {{{}, {"B"}}, {{}, {}}}, // received
-    {{{}, {}}, {{"B"}, {}}} // sent
+    {{{}, {}}, {{"B"}, {}}}, // sent
+    {{}, {"B"}} // reset
   }
 ));
 
@@ -97,7 +117,8 @@ INSTANTIATE_TEST_CASE_P(ChangeTrafficAmount, ModuleGraphCreatorSimple, testing::
     {{{}, {"B"}}, {{"A"}, {}}}, // sent
     createConfig({{{"B", "Bc"}}, {{"A", "Bm"}}}),
     {{{}, {}}, {{"B"}, {}}}, // received
-    {{{}, {"B"}}, {{}, {}}} // sent
+    {{{}, {"B"}}, {{}, {}}}, // sent
+    {{}, {}} // reset
   },
   Parameters // 1
   {
@@ -106,7 +127,8 @@ INSTANTIATE_TEST_CASE_P(ChangeTrafficAmount, ModuleGraphCreatorSimple, testing::
     {{{}, {"B"}}, {{}, {}}}, // sent
     createConfig({{{"B", "Bc"}, {"C", "Ec"}}, {{"A", "Bm"}}}),
     {{{}, {"A"}}, {{"B"}, {}}}, // received
-    {{{}, {"B"}}, {{"A"}, {}}} // sent
+    {{{}, {"B"}}, {{"A"}, {}}}, // sent
+    {{}, {}} // reset
   },
   // Receive/sent 1->2/2->1
   Parameters // 2
@@ -116,7 +138,8 @@ INSTANTIATE_TEST_CASE_P(ChangeTrafficAmount, ModuleGraphCreatorSimple, testing::
     {{{}, {"C", "B"}}, {{"A"}, {}}}, // sent
     createConfig({{{"B", "Cc"}, {"C", "Ec"}}, {{"A", "Bm"}}}),
     {{{}, {"A"}}, {{"B"}, {}}}, // received
-    {{{}, {"B"}}, {{"A"}, {}}} // sent
+    {{{}, {"B"}}, {{"A"}, {}}}, // sent
+    {{}, {}} // reset
   },
   Parameters // 3
   {
@@ -125,7 +148,8 @@ INSTANTIATE_TEST_CASE_P(ChangeTrafficAmount, ModuleGraphCreatorSimple, testing::
     {{{}, {"B"}}, {{"A"}, {}}}, // sent
     createConfig({{{"B", "Cc"}, {"C", "Ec"}}, {{"A", "Bm"}, {"D", "Am"}}}),
     {{{}, {"A"}}, {{"B", "C"}, {}}}, // received
-    {{{}, {"B", "C"}}, {{"A"}, {}}} // sent
+    {{{}, {"B", "C"}}, {{"A"}, {}}}, // sent
+    {{}, {}} // reset
   }
 ));
 
@@ -139,7 +163,8 @@ INSTANTIATE_TEST_CASE_P(ProvidedInBoth, ModuleGraphCreatorSimple, testing::Value
     {{{}, {"B"}}, {{}, {}}}, // sent
     createConfig({{{"A", "Ac"}, {"B", "Cc"}}, {{"A", "Bm"}}}),
     {{{}, {}}, {{"B"}, {}}}, // received
-    {{{}, {"B"}}, {{}, {}}} // sent
+    {{{}, {"B"}}, {{}, {}}}, // sent
+    {{"B"}, {}} // reset
   },
   // Not send/received anymore
   Parameters // 1
@@ -149,7 +174,8 @@ INSTANTIATE_TEST_CASE_P(ProvidedInBoth, ModuleGraphCreatorSimple, testing::Value
     {{{}, {"B"}}, {{"A"}, {}}}, // sent
     createConfig({{{"A", "Ac"}, {"B", "Bc"}, {"C", "Ec"}}, {{"A", "Bm"}}}),
     {{{}, {}}, {{"B"}, {}}}, // received
-    {{{}, {"B"}}, {{}, {}}} // sent
+    {{{}, {"B"}}, {{}, {}}}, // sent
+    {{}, {}} // reset
   },
   Parameters // 2
   {
@@ -158,7 +184,8 @@ INSTANTIATE_TEST_CASE_P(ProvidedInBoth, ModuleGraphCreatorSimple, testing::Value
     {{{}, {"B"}}, {{}, {}}}, // sent
     createConfig({{{"B", "Bc"}, {"C", "Ec"}}, {{"A", "Bm"}}}),
     {{{}, {"A"}}, {{"B"}, {}}}, // received
-    {{{}, {"B"}}, {{"A"}, {}}} // sent
+    {{{}, {"B"}}, {{"A"}, {}}}, // sent
+    {{}, {}} // reset
   }
 ));
 
@@ -171,7 +198,8 @@ INSTANTIATE_TEST_CASE_P(RequireProvideSame, ModuleGraphCreatorSimple, testing::V
     {{{}, {"C"}}, {{}, {}}}, // sent
     createConfig({{{"C", "Dc"}, {"A", "Ac"}}, {{"A", "Cm"}, {"B", "Cm"}}}),
     {{{}, {}}, {{"C"}, {}}}, // received
-    {{{}, {"C"}}, {{}, {}}} // sent
+    {{{}, {"C"}}, {{}, {}}}, // sent
+    {{}, {}} // reset
   }
 ));
 
@@ -184,7 +212,8 @@ INSTANTIATE_TEST_CASE_P(SwitchConfig, ModuleGraphCreatorSimple, testing::Values(
     {{{}, {"B"}}, {{}, {}}}, // sent
     createConfig({{{"C", "Dc"}}, {{"D", "Am"}}}),
     {{{}, {}}, {{"C"}, {}}}, // received
-    {{{}, {"C"}}, {{}, {}}} // sent
+    {{{}, {"C"}}, {{}, {}}}, // sent
+    {{}, {}} // reset
   },
   Parameters // 1
   {
@@ -193,7 +222,8 @@ INSTANTIATE_TEST_CASE_P(SwitchConfig, ModuleGraphCreatorSimple, testing::Values(
     {{{}, {"C", "B"}}, {{"A"}, {}}}, // sent
     createConfig({{{"A", "Ac"}, {"C", "Dc"}}, {{"B", "Cm"}}}),
     {{{}, {}}, {{"A", "C"}, {}}}, // received
-    {{{}, {"A", "C"}}, {{}, {}}} // sent
+    {{{}, {"A", "C"}}, {{}, {}}}, // sent
+    {{"C"}, {}} // reset
   }
 ));
 
@@ -203,6 +233,16 @@ INSTANTIATE_TEST_CASE_P(Default, ModuleGraphCreatorSimple, testing::Values(
     createConfig({{}, {}}),
     {{{}, {}}, {{}, {}}}, {{{}, {}}, {{}, {}}},
     createConfig({{{"B", "Cc"}}, {}}, {"A"}),
-    {{{}, {}}, {{}, {}}}, {{{}, {}}, {{}, {}}}
+    {{{}, {}}, {{}, {}}}, {{{}, {}}, {{}, {}}},
+    {{}, {}} // reset
+  },
+  // The provider of A is removed and A is provided by default instead.
+  Parameters // 1
+  {
+    createConfig({{{"A", "Ac"}, {"B", "Cc"}}, {}}),
+    {{{}, {}}, {{}, {}}}, {{{}, {}}, {{}, {}}},
+    createConfig({{{"B", "Cc"}}, {}}, {"A"}),
+    {{{}, {}}, {{}, {}}}, {{{}, {}}, {{}, {}}},
+    {{"A"}, {}} // reset
   }
 ));
@@ -0,0 +1,82 @@
+#include "Representations/Configuration/RobotDimensions.h"
+#include "Representations/Infrastructure/JointAngles.h"
+#include "Tools/Math/Random.h"
+#include "Tools/Math/Rotation.h"
+#include "Tools/Motion/InverseKinematic.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+  RobotDimensions getRobotDimensions()
+  {
+    RobotDimensions robotDimensions;
+    robotDimensions.yHipOffset = 50.f;
+    robotDimensions.upperLegLength = 100.f;
+    robotDimensions.lowerLegLength = 102.9f;
+    robotDimensions.footHeight = 45.19f;
+    return robotDimensions;
+  }
+
+  Pose3f randomFootPose(float sign, float minHeight)
+  {
+    const Quaternionf rotation = Rotation::aroundZ(Random::uniform(-0.5f, 0.5f))
+                                 * Rotation::aroundY(Random::uniform(-0.3f, 0.3f))
+                                 * Rotation::aroundX(Random::uniform(-0.3f, 0.3f));
+    return Pose3f(rotation, Vector3f(Random::uniform(-80.f, 80.f),
+                                     sign * Random::uniform(10.f, 110.f),
+                                     Random::uniform(minHeight, -200.f)));
+  }
+
+  void compareWithSingleSolutions(size_t count, float minHeight, float ratio)
+  {
+    const RobotDimensions robotDimensions = getRobotDimensions();
+    const Quaternionf bodyRotation = Rotation::aroundX(Random::uniform(-0.2f, 0.2f)) * Rotation::aroundY(Random::uniform(-0.2f, 0.2f));
+
+    std::vector<Pose3f> positionsLeft;
+    std::vector<Pose3f> positionsRight;
+    for(size_t i = 0; i < count; ++i)
+    {
+      positionsLeft.emplace_back(randomFootPose(1.f, minHeight));
+      positionsRight.emplace_back(randomFootPose(-1.f, minHeight));
+    }
+
+    std::vector<JointAngles> batched(count);
+    std::unique_ptr<bool[]> reachable(new bool[count]);
+    const unsigned numOfReachable = InverseKinematic::calcLegJoints(positionsLeft.data(), positionsRight.data(), count, bodyRotation,
+                                                                    batched.data(), reachable.get(), robotDimensions, ratio);
+
+    unsigned expectedNumOfReachable = 0;
+    for(size_t i = 0; i < count; ++i)
+    {
+      JointAngles single;
+      const bool singleReachable = InverseKinematic::calcLegJoints(positionsLeft[i], positionsRight[i], bodyRotation, single, robotDimensions, ratio);
+      expectedNumOfReachable += singleReachable ? 1 : 0;
+
+      EXPECT_EQ(singleReachable, reachable[i]);
+
+      for(int j = Joints::firstLegJoint; j < Joints::numOfJoints; ++j)
+        EXPECT_NEAR(single.angles[j], batched[i].angles[j], 1e-3f) << "pair " << i << ", joint " << j;
+    }
+
+    EXPECT_EQ(expectedNumOfReachable, numOfReachable);
+  }
+}
+
+GTEST_TEST(InverseKinematic, batchedLegJointsMatchSingleSolutions)
+{
+  for(size_t count : {1, 4, 37})
+  {
+    compareWithSingleSolutions(count, -250.f, 0.5f);
+    compareWithSingleSolutions(count, -250.f, 0.f);
+    compareWithSingleSolutions(count, -250.f, 1.f);
+  }
+}
+
+GTEST_TEST(InverseKinematic, batchedLegJointsMatchSingleSolutionsWhenUnreachable)
+{
+  compareWithSingleSolutions(64, -350.f, 0.5f);
+}
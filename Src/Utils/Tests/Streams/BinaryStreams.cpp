@@ -0,0 +1,195 @@
+#include "Tools/Math/Angle.h"
+#include "Tools/Math/Eigen.h"
+#include "Tools/Math/Random.h"
+#include "Tools/Streams/AutoStreamable.h"
+#include "Tools/Streams/InStreams.h"
+#include "Tools/Streams/OutStreams.h"
+#include "Utils/Tests/bench.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+#ifndef NDEBUG
+#define RUNS 100
+#else
+#define RUNS 10000
+#endif
+
+STREAMABLE(BinaryStreamsTestData,
+{,
+  (Vector2f) point,
+  (Matrix3f) matrix,
+  (Quaternionf) rotation,
+  (std::vector<Vector2f>) points,
+  (std::vector<Angle>) angles,
+  (std::array<Vector3f, 4>) corners,
+});
+
+STREAMABLE(BinaryStreamsPackedData,
+{,
+  (int) number,
+  (float) value,
+  (Angle) angle,
+  (Vector2f) point,
+  (short[3]) triple,
+});
+
+STREAMABLE(BinaryStreamsMixedData,
+{,
+  (bool) flag,
+  (std::string) name,
+  (BinaryStreamsPackedData) packed,
+  (std::vector<BinaryStreamsPackedData>) list,
+});
+
+namespace
+{
+  BinaryStreamsTestData randomData(size_t numOfPoints)
+  {
+    BinaryStreamsTestData data;
+    data.point = Vector2f(Random::uniform(-1000.f, 1000.f), Random::uniform(-1000.f, 1000.f));
+    data.matrix = Matrix3f::Random();
+    data.rotation = Quaternionf(Vector4f::Random().normalized());
+    for(size_t i = 0; i < numOfPoints; ++i)
+    {
+      data.points.emplace_back(Random::uniform(-1000.f, 1000.f), Random::uniform(-1000.f, 1000.f));
+      data.angles.emplace_back(Random::uniform(-pi, pi));
+    }
+    for(Vector3f& corner : data.corners)
+      corner = Vector3f::Random();
+    return data;
+  }
+}
+
+GTEST_TEST(BinaryStreams, roundTrip)
+{
+  const BinaryStreamsTestData data = randomData(37);
+  OutBinaryMemory out;
+  out << data;
+
+  BinaryStreamsTestData read;
+  InBinaryMemory in(out.data(), out.size());
+  in >> read;
+
+  EXPECT_EQ(data.point, read.point);
+  EXPECT_EQ(data.matrix, read.matrix);
+  EXPECT_EQ(data.rotation.coeffs(), read.rotation.coeffs());
+  EXPECT_EQ(data.points, read.points);
+  ASSERT_EQ(data.angles.size(), read.angles.size());
+  for(size_t i = 0; i < data.angles.size(); ++i)
+    EXPECT_EQ(static_cast<float>(data.angles[i]), static_cast<float>(read.angles[i]));
+  for(size_t i = 0; i < data.corners.size(); ++i)
+    EXPECT_EQ(data.corners[i], read.corners[i]);
+}
+
+GTEST_TEST(BinaryStreams, blocksHaveElementwiseLayout)
+{
+  const BinaryStreamsTestData data = randomData(5);
+  OutBinaryMemory blocks;
+  blocks << data;
+
+  // This is how the data was written before blocks were streamed at once.
+  OutBinaryMemory elements;
+  elements << data.point.x() << data.point.y();
+  for(int i = 0; i < 9; ++i)
+    elements << data.matrix.data()[i];
+  elements << data.rotation.x() << data.rotation.y() << data.rotation.z() << data.rotation.w();
+  elements << static_cast<unsigned>(data.points.size());
+  for(const Vector2f& point : data.points)
+    elements << point.x() << point.y();
+  elements << static_cast<unsigned>(data.angles.size());
+  for(const Angle& angle : data.angles)
+    elements << static_cast<float>(angle);
+  for(const Vector3f& corner : data.corners)
+    elements << corner.x() << corner.y() << corner.z();
+
+  ASSERT_EQ(elements.size(), blocks.size());
+  EXPECT_EQ(0, std::memcmp(elements.data(), blocks.data(), blocks.size()));
+}
+
+GTEST_TEST(BinaryStreams, generatedSerializers)
+{
+  BinaryStreamsMixedData data;
+  data.flag = true;
+  data.name = "name";
+  data.packed.number = 42;
+  data.packed.value = 1.5f;
+  data.packed.angle = 2_deg;
+  data.packed.point = Vector2f(3.f, 4.f);
+  data.packed.triple[0] = 5;
+  data.packed.triple[1] = 6;
+  data.packed.triple[2] = 7;
+  data.list.resize(2, data.packed);
+  data.list[1].number = -1;
+  OutBinaryMemory generated;
+  generated << data;
+
+  // This is how STREAMABLE wrote the data before the binary serializers were generated.
+  OutBinaryMemory elements;
+  elements << data.flag << data.name;
+  for(const BinaryStreamsPackedData* packed : {&data.packed, &data.list[0], &data.list[1]})
+  {
+    if(packed == &data.list[0])
+      elements << static_cast<unsigned>(data.list.size());
+    elements << packed->number << packed->value << static_cast<float>(packed->angle) << packed->point.x() << packed->point.y();
+    for(short s : packed->triple)
+      elements << s;
+  }
+
+  ASSERT_EQ(elements.size(), generated.size());
+  EXPECT_EQ(0, std::memcmp(elements.data(), generated.data(), generated.size()));
+
+  BinaryStreamsMixedData read;
+  InBinaryMemory in(generated.data(), generated.size());
+  in >> read;
+  EXPECT_EQ(data.flag, read.flag);
+  EXPECT_EQ(data.name, read.name);
+  ASSERT_EQ(data.list.size(), read.list.size());
+  EXPECT_EQ(-1, read.list[1].number);
+  EXPECT_EQ(data.packed.value, read.packed.value);
+  EXPECT_EQ(static_cast<float>(data.packed.angle), static_cast<float>(read.packed.angle));
+  EXPECT_EQ(data.packed.point, read.packed.point);
+  EXPECT_EQ(7, read.packed.triple[2]);
+}
+
+GTEST_TEST(BinaryStreams, vectorBenchmark)
+{
+  std::vector<Vector2f> points(500);
+  for(Vector2f& point : points)
+    point = Vector2f(Random::uniform(-1000.f, 1000.f), Random::uniform(-1000.f, 1000.f));
+  const size_t size = points.size() * sizeof(Vector2f);
+  char buffer[500 * sizeof(Vector2f)];
+
+  const auto writeElements = [&]
+  {
+    OutBinaryMemory out(size, buffer);
+    Streaming::streamComplexStaticArray(out, points.data(), size, nullptr);
+  };
+  const auto writeBlock = [&]
+  {
+    OutBinaryMemory out(size, buffer);
+    Streaming::streamStaticArray(out, points.data(), size, nullptr);
+  };
+  const auto readElements = [&]
+  {
+    InBinaryMemory in(buffer, size);
+    Streaming::streamComplexStaticArray(in, points.data(), size, nullptr);
+  };
+  const auto readBlock = [&]
+  {
+    InBinaryMemory in(buffer, size);
+    Streaming::streamStaticArray(in, points.data(), size, nullptr);
+  };
+
+  PRINTF("writing 500 points element by element: ");
+  RUN_BENCH(10, RUNS, writeElements());
+  PRINTF("writing 500 points as a block: ");
+  RUN_BENCH(10, RUNS, writeBlock());
+  PRINTF("reading 500 points element by element: ");
+  RUN_BENCH(10, RUNS, readElements());
+  PRINTF("reading 500 points as a block: ");
+  RUN_BENCH(10, RUNS, readBlock());
+}
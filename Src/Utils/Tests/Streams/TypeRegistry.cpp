@@ -0,0 +1,137 @@
+#include "Tools/Math/Angle.h"
+#include "Tools/Math/Eigen.h"
+#include "Tools/Streams/TypeRegistry.h"
+#include "Utils/Tests/bench.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <cstdlib>
+#include <list>
+#include <regex>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+// The regular expressions compared with only worked on names demangled by the ABI.
+#ifndef WINDOWS
+#include <cxxabi.h>
+
+#ifndef NDEBUG
+#define RUNS 10
+#else
+#define RUNS 100
+#endif
+
+namespace
+{
+  enum TestEnum {a, b};
+  struct TestStruct {};
+
+  /** The implementation of TypeRegistry::demangle that used regular expressions (without Windows). */
+  std::string demangleWithRegex(const std::string& type)
+  {
+    static std::regex matchAnonymousNamespace("::__1\\b");
+    static std::regex matchCXX11Namespace("::__cxx11\\b");
+    static std::regex matchNumberSuffix("\\b([0-9][0-9]*)[ul]l*\\b");
+    static std::regex matchComma(", ");
+    static std::regex matchAngularBracket(" >");
+    static std::regex matchBracket(" \\[");
+    static std::regex matchAsterisk(" *\\(\\*[^)]*\\)");
+    static std::regex matchString("std::basic_string<char,std::char_traits<char>,std::allocator<char>>");
+    static std::regex matchArray("std::array<(.*),([0-9][0-9]*)>");
+    static std::regex matchList("std::list<(.*),std::allocator<\\1>>");
+    static std::regex matchVector("std::vector<(.*),(std::allocator|Eigen::aligned_allocator)<\\1>>");
+
+    std::string result = std::regex_replace(type, matchAnonymousNamespace, "");
+    result = std::regex_replace(result, matchCXX11Namespace, "");
+    result = std::regex_replace(result, matchNumberSuffix, "$1");
+    result = std::regex_replace(result, matchComma, ",");
+    result = std::regex_replace(result, matchAngularBracket, ">");
+    result = std::regex_replace(result, matchBracket, "[");
+    result = std::regex_replace(result, matchAsterisk, "");
+    result = std::regex_replace(result, matchString, "std::string");
+    std::string oldResult;
+    do
+    {
+      oldResult = result;
+      result = std::regex_replace(result, matchArray, "$1[$2]");
+      result = std::regex_replace(result, matchList, "$1*");
+      result = std::regex_replace(result, matchVector, "$1*");
+    }
+    while(oldResult != result);
+    return result;
+  }
+
+  const std::vector<const char*> names =
+  {
+    typeid(int).name(),
+    typeid(std::string).name(),
+    typeid(Angle).name(),
+    typeid(TestEnum).name(),
+    typeid(TestStruct).name(),
+    typeid(int[3]).name(),
+    typeid(float[2][3]).name(),
+    typeid(Vector2f).name(),
+    typeid(Matrix3f).name(),
+    typeid(Quaternionf).name(),
+    typeid(std::array<int, 3>).name(),
+    typeid(std::array<std::array<int, 1>, 2>).name(),
+    typeid(std::array<Vector3f, 4>).name(),
+    typeid(std::array<std::string, 2>).name(),
+    typeid(std::vector<int>).name(),
+    typeid(std::vector<std::string>).name(),
+    typeid(std::vector<Vector2f>).name(),
+    typeid(std::vector<Vector2f, Eigen::aligned_allocator<Vector2f>>).name(),
+    typeid(std::vector<std::vector<TestEnum>>).name(),
+    typeid(std::vector<std::array<float, 3>>).name(),
+    typeid(std::array<std::vector<float>, 3>).name(),
+    typeid(std::list<int>).name(),
+    typeid(std::list<std::vector<std::string>>).name(),
+    typeid(std::vector<std::list<TestStruct>>).name(),
+    typeid(void (*)(int)).name(),
+  };
+}
+
+GTEST_TEST(TypeRegistry, demangleLikeRegex)
+{
+  for(const char* name : names)
+  {
+    const std::string demangled = TypeRegistry::demangle(name);
+    int status;
+    char* buffer = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    ASSERT_NE(nullptr, buffer);
+    const std::string expected = demangleWithRegex(buffer);
+    std::free(buffer);
+    EXPECT_EQ(expected, demangled);
+  }
+  EXPECT_EQ("int[3]", TypeRegistry::demangle(typeid(std::array<int, 3>).name()));
+  EXPECT_EQ("std::string*", TypeRegistry::demangle(typeid(std::vector<std::string>).name()));
+  EXPECT_EQ("float*", TypeRegistry::demangle(typeid(std::list<float>).name()));
+}
+
+GTEST_TEST(TypeRegistry, demangleBenchmark)
+{
+  const auto demangleAll = [](bool regex)
+  {
+    for(const char* name : names)
+    {
+      if(regex)
+      {
+        int status;
+        char* buffer = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+        static_cast<void>(demangleWithRegex(buffer));
+        std::free(buffer);
+      }
+      else
+        static_cast<void>(TypeRegistry::demangle(name));
+    }
+  };
+
+  PRINTF("demangling with regular expressions: ");
+  RUN_BENCH(3, RUNS, demangleAll(true));
+  PRINTF("demangling without regular expressions: ");
+  RUN_BENCH(3, RUNS, demangleAll(false));
+}
+
+#endif
@@ -0,0 +1,33 @@
+#include "Tools/Parallel.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <vector>
+
+GTEST_TEST(Parallel, forEachCallsEachNumberOnce)
+{
+  for(size_t n : {0, 1, 7, 1000})
+  {
+    std::vector<std::atomic<int>> calls(n);
+    Parallel::forEach(n, [&](size_t i) {++calls[i];}, 4);
+    for(const std::atomic<int>& count : calls)
+      EXPECT_EQ(1, count);
+  }
+}
+
+GTEST_TEST(Parallel, workersExecuteAllTasks)
+{
+  std::atomic<int> sum(0);
+  {
+    Parallel::Workers workers(3, 2);
+    for(int i = 1; i <= 100; ++i)
+      workers.add([&sum, i] {sum += i;});
+    workers.wait();
+    EXPECT_EQ(5050, sum);
+
+    for(int i = 1; i <= 10; ++i)
+      workers.add([&sum] {++sum;});
+  }
+  EXPECT_EQ(5060, sum);
+}
@@ -3,6 +3,8 @@
 #include "gPrintf.h"
 #include "bench/BenchTimer.h"
 
+#define PROTECT(...) __VA_ARGS__
+
 #define RUN_BENCH(TRIES,REP, ...) do { \
     Eigen::BenchTimer timer; \
     BENCH(timer, TRIES, REP, PROTECT(__VA_ARGS__)) \
@@ -133,6 +133,8 @@ private:
   const QString& getAppPath() const override {return appPath;}
   QSettings& getSettings() override {return settings;}
   QSettings& getLayoutSettings() override {return layoutSettings;}
+  QString getOption(const QString& name) const override {return QString();}
+  void setFailed() override {}
 
   void closeEvent(QCloseEvent* event) override;
   void timerEvent(QTimerEvent* event) override;
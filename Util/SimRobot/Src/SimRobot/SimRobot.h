@@ -156,6 +156,8 @@ namespace SimRobot
     virtual const QString& getAppPath() const = 0;
     virtual QSettings& getSettings() = 0;
     virtual QSettings& getLayoutSettings() = 0;
+    virtual QString getOption(const QString& name) const = 0; /**< Returns a command line option of the application or an empty string if it was not given. */
+    virtual void setFailed() = 0; /**< Marks the run as failed, so that a batch run ends with a failure exit code. */
     virtual bool isSimRunning() = 0;
     virtual void simReset() = 0;
     virtual void simStart() = 0;
@@ -7,6 +7,9 @@
 #include "Platform/OpenGL.h"
 #include <QGLPixelBuffer>
 #include <QGLWidget>
+#include <algorithm>
+#include <cstring>
+#include <functional>
 
 #include "Platform/OffscreenRenderer.h"
 #include "Platform/Assert.h"
@@ -42,6 +45,7 @@ bool OffscreenRenderer::makeCurrent(int width, int height, bool sampleBuffers)
   if(it == renderBuffers.end())
   {
     Buffer& buffer = renderBuffers[width << 16 | height << 1 | (sampleBuffers ? 1 : 0)];
+    currentBuffer = &buffer;
 
     if(!initPixelBuffer(width, height, sampleBuffers, buffer))
       if(!initFrameBuffer(width, height, buffer))
@@ -50,22 +54,25 @@ bool OffscreenRenderer::makeCurrent(int width, int height, bool sampleBuffers)
     return true;
   }
   else
+    return makeCurrent(it->second);
+}
+
+bool OffscreenRenderer::makeCurrent(Buffer& buffer)
+{
+  currentBuffer = &buffer;
+  if(buffer.pbuffer)
+    return buffer.pbuffer->makeCurrent();
+  if(buffer.frameBufferId)
   {
-    Buffer& buffer = it->second;
-    if(buffer.pbuffer)
-      return buffer.pbuffer->makeCurrent();
-    if(buffer.frameBufferId)
-    {
-      mainGlWidget->makeCurrent();
-      glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, buffer.frameBufferId);
-      return true;
-    }
-    if(buffer.glWidget)
-      buffer.glWidget->makeCurrent();
-    else
-      mainGlWidget->makeCurrent();
+    mainGlWidget->makeCurrent();
+    glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, buffer.frameBufferId);
     return true;
   }
+  if(buffer.glWidget)
+    buffer.glWidget->makeCurrent();
+  else
+    mainGlWidget->makeCurrent();
+  return true;
 }
 
 bool OffscreenRenderer::initFrameBuffer(int width, int height, Buffer& buffer)
@@ -150,6 +157,18 @@ void OffscreenRenderer::init()
   mainGlWidget = new QGLWidget(format, nullptr, nullptr, Qt::WindowStaysOnTopHint);
   mainGlWidget->makeCurrent();
   initContext(false);
+
+  GLint maxViewportDims[2];
+  glGetIntegerv(GL_MAX_VIEWPORT_DIMS, maxViewportDims);
+  maxSize = std::min(maxViewportDims[0], maxViewportDims[1]);
+#ifndef MACOS
+  if(GLEW_EXT_framebuffer_object)
+#endif
+  {
+    GLint maxRenderbufferSize;
+    glGetIntegerv(GL_MAX_RENDERBUFFER_SIZE_EXT, &maxRenderbufferSize);
+    maxSize = std::min(maxSize, static_cast<int>(maxRenderbufferSize));
+  }
 }
 
 void OffscreenRenderer::finishImageRendering(void* image, int w, int h)
@@ -159,6 +178,77 @@ void OffscreenRenderer::finishImageRendering(void* image, int w, int h)
   glReadPixels(0, 0, w, h, GL_RGB, GL_UNSIGNED_BYTE, image);
 }
 
+void OffscreenRenderer::startImageReadback(void* image, int w, int h)
+{
+  ASSERT(currentBuffer);
+  ASSERT(pendingReadbacks.empty() || readbackBuffer == currentBuffer);
+
+#ifndef MACOS
+  if(!GLEW_VERSION_2_1)
+  {
+    finishImageRendering(image, w, h);
+    return;
+  }
+#endif
+
+  const int lineSize = w * 3;
+  const unsigned int size = static_cast<unsigned int>(lineSize * h);
+  unsigned int offset = pendingReadbacks.empty() ? 0 : pendingReadbacks.back().offset + pendingReadbacks.back().size;
+  offset = (offset + 7) & ~7u;
+
+  Buffer& buffer = *currentBuffer;
+  if(!buffer.packBufferId)
+    glGenBuffers(1, &buffer.packBufferId);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.packBufferId);
+  if(offset + size > buffer.packBufferSize)
+  {
+    // Growing the buffer object discards its contents, so the pending images are copied first.
+    if(!pendingReadbacks.empty())
+    {
+      finishImageReadbacks();
+      makeCurrent(buffer);
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.packBufferId);
+      offset = 0;
+    }
+    buffer.packBufferSize = std::max(size, buffer.packBufferSize * 2);
+    glBufferData(GL_PIXEL_PACK_BUFFER, buffer.packBufferSize, nullptr, GL_STREAM_READ);
+  }
+
+  glPixelStorei(GL_PACK_ALIGNMENT, lineSize & (8 - 1) ? (lineSize & (4 - 1) ? 1 : 4) : 8);
+  glReadPixels(0, 0, w, h, GL_RGB, GL_UNSIGNED_BYTE, reinterpret_cast<void*>(static_cast<size_t>(offset)));
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  readbackBuffer = &buffer;
+  pendingReadbacks.push_back({image, offset, size});
+}
+
+void OffscreenRenderer::finishImageReadbacks()
+{
+  if(pendingReadbacks.empty())
+    return;
+
+  // The transfers were started in the context of the readback buffer, which might not be current anymore.
+  makeCurrent(*readbackBuffer);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, readbackBuffer->packBufferId);
+  const unsigned char* data = static_cast<const unsigned char*>(glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY));
+  if(data)
+  {
+    for(const PendingReadback& pendingReadback : pendingReadbacks)
+      std::memcpy(pendingReadback.image, data + pendingReadback.offset, pendingReadback.size);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  }
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  pendingReadbacks.clear();
+}
+
+void OffscreenRenderer::discardImageReadbacks(const void* begin, const void* end)
+{
+  pendingReadbacks.erase(std::remove_if(pendingReadbacks.begin(), pendingReadbacks.end(), [begin, end](const PendingReadback& pendingReadback)
+  {
+    return !std::less<const void*>()(pendingReadback.image, begin) && std::less<const void*>()(pendingReadback.image, end);
+  }), pendingReadbacks.end());
+}
+
 void OffscreenRenderer::finishDepthRendering(void* image, int w, int h)
 {
   glPixelStorei(GL_PACK_ALIGNMENT, w * 4 & (8 - 1) ? 4 : 8);
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 
 class QGLPixelBuffer;
 class QGLWidget;
@@ -54,6 +55,35 @@ public:
   */
   void finishImageRendering(void* image, int width, int height);
 
+  /**
+  * Starts reading an image from the current rendering context. If pixel buffer objects are
+  * supported, the image is transferred asynchronously and only copied to \c image when
+  * finishImageReadbacks() is called. Otherwise, it is read immediately.
+  * Several readbacks can be pending, but all of them must be started in the same context.
+  * @param image The buffer where the image will be saved to.
+  * @param width The image width.
+  * @param height The image height.
+  */
+  void startImageReadback(void* image, int width, int height);
+
+  /** Waits for all pending image readbacks and copies the images to their buffers. */
+  void finishImageReadbacks();
+
+  /**
+  * Forgets the pending image readbacks into a memory area without copying them, e.g. because
+  * it is freed. Other pending readbacks are kept.
+  * @param begin The start of the memory area.
+  * @param end The end of the memory area.
+  */
+  void discardImageReadbacks(const void* begin, const void* end);
+
+  /**
+  * Returns the largest width or height of an image that can be rendered.
+  * Only available when init() was called.
+  * @return The maximum size in pixels.
+  */
+  int getMaxSize() const {return maxSize;}
+
   /**
   * Reads a depth image from current rendering context.
   * @param image The buffer where is image will be saved to.
@@ -87,6 +117,8 @@ private:
     QGLPixelBuffer* pbuffer;
     unsigned int frameBufferId;
     unsigned int renderBufferIds[2];
+    unsigned int packBufferId = 0; /**< A pixel buffer object used for asynchronous readbacks. */
+    unsigned int packBufferSize = 0; /**< The size of the pixel buffer object in bytes. */
 
     /** Default constructor */
     Buffer() : glWidget(0), pbuffer(0), frameBufferId(0) {}
@@ -95,9 +127,28 @@ private:
     ~Buffer();
   };
 
+  /** An image that is transferred into a pixel buffer object, but not copied to its destination yet. */
+  struct PendingReadback
+  {
+    void* image; /**< The buffer where the image will be saved to. */
+    unsigned int offset; /**< The offset of the image in the pixel buffer object. */
+    unsigned int size; /**< The size of the image in bytes. */
+  };
+
   QGLWidget* mainGlWidget = nullptr;
   bool usedMainGlWidget = false;
   std::unordered_map<unsigned int, Buffer> renderBuffers;
+  Buffer* currentBuffer = nullptr; /**< The buffer selected by the last call to makeCurrent(). */
+  Buffer* readbackBuffer = nullptr; /**< The buffer from which the pending readbacks are transferred. */
+  std::vector<PendingReadback> pendingReadbacks;
+  int maxSize = 0;
+
+  /**
+  * Selects the OpenGL context of an existing buffer.
+  * @param buffer The buffer.
+  * @return Whether the OpenGL context was successfully selected
+  */
+  bool makeCurrent(Buffer& buffer);
 
   /**
   * Initializes the currently selected OpenGL context for off-screen rendering
@@ -14,6 +14,8 @@
 #include "Tools/OpenGLTools.h"
 #include "CoreModule.h"
 
+#include <algorithm>
+
 Camera::Camera()
 {
   sensor.camera = this;
@@ -25,7 +27,11 @@ Camera::Camera()
 Camera::~Camera()
 {
   if(sensor.imageBuffer)
+  {
+    // The buffer might still be the destination of an image readback.
+    Simulation::simulation->renderer.discardImageReadbacks(sensor.imageBuffer, sensor.imageBuffer + sensor.imageBufferSize);
     delete[] sensor.imageBuffer;
+  }
 }
 
 void Camera::createPhysics()
@@ -60,6 +66,13 @@ void Camera::registerObjects()
   Sensor::registerObjects();
 }
 
+SimRobotCore2::SensorPort::Data Camera::CameraSensor::getValue()
+{
+  // The image might have been rendered by renderCameraImages, but not been read yet.
+  Simulation::simulation->renderer.finishImageReadbacks();
+  return Sensor::Port::getValue();
+}
+
 void Camera::CameraSensor::updateValue()
 {
   // allocate buffer
@@ -116,6 +129,10 @@ bool Camera::CameraSensor::renderCameraImages(SimRobotCore2::SensorPort** camera
   if(lastSimulationStep == Simulation::simulation->simulationStep)
     return true;
 
+  // The buffer might still be the destination of a previous readback.
+  OffscreenRenderer& renderer = Simulation::simulation->renderer;
+  renderer.finishImageReadbacks();
+
   // allocate buffer
   const unsigned int imageWidth = camera->imageWidth;
   const unsigned int imageHeight = camera->imageHeight;
@@ -142,8 +159,10 @@ bool Camera::CameraSensor::renderCameraImages(SimRobotCore2::SensorPort** camera
   Simulation::simulation->scene->updateTransformations();
 
   // prepare offscreen renderer
-  OffscreenRenderer& renderer = Simulation::simulation->renderer;
-  renderer.makeCurrent(imageWidth, imageHeight * count);
+  // The images are rendered on top of each other. If they do not fit into a single
+  // buffer, the buffer is filled and read several times.
+  const unsigned int imagesPerPass = std::max(1u, std::min(count, static_cast<unsigned int>(renderer.getMaxSize()) / imageHeight));
+  renderer.makeCurrent(imageWidth, imageHeight * imagesPerPass);
 
   // setup angle of view
   glMatrixMode(GL_PROJECTION);
@@ -160,14 +179,23 @@ bool Camera::CameraSensor::renderCameraImages(SimRobotCore2::SensorPort** camera
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
   // render images
-  int currentHorizontalPos = 0;
+  unsigned int currentHorizontalPos = 0;
   unsigned char* currentBufferPos = imageBuffer;
+  unsigned char* passBufferPos = imageBuffer;
   for(unsigned int i = 0; i < count; ++i)
   {
     CameraSensor* sensor = static_cast<CameraSensor*>(cameras[i]);
     if(sensor && sensor->lastSimulationStep != Simulation::simulation->simulationStep &&
        sensor->camera->imageWidth == imageWidth && sensor->camera->imageHeight == imageHeight)
     {
+      if(currentHorizontalPos == imageHeight * imagesPerPass)
+      {
+        renderer.startImageReadback(passBufferPos, imageWidth, currentHorizontalPos);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        currentHorizontalPos = 0;
+        passBufferPos = currentBufferPos;
+      }
+
       glViewport(0, currentHorizontalPos, imageWidth, imageHeight);
 
       // setup camera position
@@ -190,8 +218,8 @@ bool Camera::CameraSensor::renderCameraImages(SimRobotCore2::SensorPort** camera
     }
   }
 
-  // read frame buffer
-  renderer.finishImageRendering(imageBuffer, imageWidth, currentHorizontalPos);
+  // read frame buffer asynchronously, the images are copied when they are accessed through getValue()
+  renderer.startImageReadback(passBufferPos, imageWidth, currentHorizontalPos);
   return true;
 }
 
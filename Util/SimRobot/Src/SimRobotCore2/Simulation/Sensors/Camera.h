@@ -42,6 +42,7 @@ private:
     void updateValue() override;
 
     //API
+    Data getValue() override;
     bool getMinAndMax(float& min, float& max) const override {min = 0; max = 0xff; return true;}
     bool renderCameraImages(SimRobotCore2::SensorPort** cameras, unsigned int count) override;
   } sensor;
@@ -35,7 +35,7 @@ public:
      /** Update the sensor value. Is called when required. */
     virtual void updateValue() = 0;
 
-  private:
+  protected:
     // API
     const QString& getFullName() const override {return fullName;}
     const QIcon* getIcon() const override;
@@ -0,0 +1,296 @@
+/**
+* @file SimRobotHeadless/HeadlessApplication.cpp
+* Implementation of an implementation of the SimRobot application interface that
+* runs a scene without any windows
+*/
+
+#include "HeadlessApplication.h"
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFileInfo>
+#include <QVector>
+#include <iostream>
+
+volatile std::sig_atomic_t HeadlessApplication::interrupted = 0;
+
+HeadlessApplication::HeadlessApplication(const QString& appPath, const QHash<QString, QString>& options) :
+  appPath(appPath),
+  options(options),
+  settings(settingsDir.filePath("settings.ini"), QSettings::IniFormat),
+  layoutSettings(settingsDir.filePath("layouts.ini"), QSettings::IniFormat)
+{}
+
+HeadlessApplication::~HeadlessApplication()
+{
+  closeFile();
+}
+
+bool HeadlessApplication::openFile(const QString& fileName)
+{
+  closeFile();
+
+  QFileInfo fileInfo(fileName);
+  if(!fileInfo.exists())
+  {
+    std::cerr << "Cannot open file " << fileName.toUtf8().constData() << "." << std::endl;
+    return false;
+  }
+  filePath = fileInfo.absoluteDir().canonicalPath() + '/' + fileInfo.fileName();
+  opened = true;
+  layoutSettings.beginGroup(fileInfo.baseName());
+
+  if(!loadModule("SimRobotCore2") || !compileModules())
+    return false;
+
+  running = true;
+  return true;
+}
+
+void HeadlessApplication::closeFile()
+{
+  if(!opened)
+    return;
+
+  // Modules are deleted in reverse order, i.e. the controllers before the simulation core they refer to.
+  while(!loadedModules.isEmpty())
+  {
+    LoadedModule* loadedModule = loadedModules.takeLast();
+    for(int i = statusLabels.size() - 1; i >= 0; --i)
+      if(statusLabels[i].module == loadedModule->module)
+        delete statusLabels.takeAt(i).label;
+    for(int i = rootObjects.size() - 1; i >= 0; --i)
+      deleteRegisteredObjectsFromModule(rootObjects[i], loadedModule->module);
+    delete loadedModule->module;
+    loadedModule->unload();
+    delete loadedModule;
+  }
+  loadedModulesByName.clear();
+
+  while(!rootObjects.isEmpty())
+    deleteRegisteredObject(rootObjects.last());
+
+  layoutSettings.endGroup();
+  filePath.clear();
+  opened = false;
+  compiled = false;
+  running = false;
+  resetRequested = false;
+}
+
+unsigned HeadlessApplication::run(unsigned steps)
+{
+  unsigned executed = 0;
+  while(running && !interrupted && (!steps || executed < steps))
+  {
+    for(LoadedModule* loadedModule : loadedModules)
+      loadedModule->module->update();
+    ++executed;
+
+    // Deliver events posted by the modules, e.g. from their threads.
+    QCoreApplication::processEvents();
+
+    if(resetRequested)
+    {
+      const QString fileName = filePath;
+      if(!openFile(fileName))
+        break;
+    }
+  }
+  return executed;
+}
+
+bool HeadlessApplication::compileModules()
+{
+  if(compiled)
+    return true;
+
+  for(int i = 0; i < loadedModules.count(); ++i) // note: list of modules may grow while compiling modules
+  {
+    LoadedModule* loadedModule = loadedModules[i];
+    if(!loadedModule->compiled)
+    {
+      loadedModule->compiled = loadedModule->module->compile();
+      if(!loadedModule->compiled)
+        return false;
+    }
+  }
+  compiled = true;
+
+  for(LoadedModule* loadedModule : loadedModules)
+    loadedModule->module->link();
+  return true;
+}
+
+void HeadlessApplication::deleteRegisteredObjectsFromModule(RegisteredObject* registeredObject, const SimRobot::Module* module)
+{
+  if(registeredObject->module == module)
+    deleteRegisteredObject(registeredObject);
+  else
+    for(int i = registeredObject->children.size() - 1; i >= 0; --i)
+      deleteRegisteredObjectsFromModule(registeredObject->children[i], module);
+}
+
+void HeadlessApplication::deleteRegisteredObject(RegisteredObject* registeredObject)
+{
+  while(!registeredObject->children.isEmpty())
+    deleteRegisteredObject(registeredObject->children.last());
+
+  if(registeredObject->parent)
+    registeredObject->parent->children.removeOne(registeredObject);
+  else
+    rootObjects.removeOne(registeredObject);
+  registeredObjectsByObject.remove(registeredObject->object);
+
+  auto i = registeredObjectsByKindAndName.find(registeredObject->kind);
+  if(i != registeredObjectsByKindAndName.end())
+  {
+    i->remove(registeredObject->fullName);
+    if(i->isEmpty())
+      registeredObjectsByKindAndName.erase(i);
+  }
+  delete registeredObject;
+}
+
+bool HeadlessApplication::registerObject(const SimRobot::Module& module, SimRobot::Object& object, const SimRobot::Object* parent, int flags)
+{
+  RegisteredObject* parentObject = parent ? registeredObjectsByObject.value(parent) : nullptr;
+  RegisteredObject* registeredObject = new RegisteredObject(&module, &object, parentObject);
+  if(parentObject)
+    parentObject->children.append(registeredObject);
+  else
+    rootObjects.append(registeredObject);
+  registeredObjectsByObject.insert(&object, registeredObject);
+  registeredObjectsByKindAndName[object.getKind()].insert(registeredObject->fullName, registeredObject);
+  return true;
+}
+
+bool HeadlessApplication::unregisterObject(const SimRobot::Object& object)
+{
+  RegisteredObject* registeredObject = registeredObjectsByObject.value(&object);
+  if(!registeredObject)
+    return false;
+  deleteRegisteredObject(registeredObject);
+  return true;
+}
+
+SimRobot::Object* HeadlessApplication::resolveObject(const QString& fullName, int kind)
+{
+  for(auto i = kind ? registeredObjectsByKindAndName.constFind(kind) : registeredObjectsByKindAndName.constBegin(); i != registeredObjectsByKindAndName.constEnd(); ++i)
+  {
+    RegisteredObject* registeredObject = i->value(fullName);
+    if(registeredObject)
+      return registeredObject->object;
+
+    if(kind)
+      break;
+  }
+  return nullptr;
+}
+
+SimRobot::Object* HeadlessApplication::resolveObject(const QVector<QString>& parts, const SimRobot::Object* parent, int kind)
+{
+  const int partsCount = parts.count();
+  if(partsCount <= 0)
+    return nullptr;
+  const QString& lastPart = parts.at(partsCount - 1);
+
+  // Same matching as in the scene graph of the GUI: every part must be the suffix of an ancestor in this order.
+  auto matches = [&](const RegisteredObject* object)
+  {
+    const RegisteredObject* currentObject = object;
+    for(int i = partsCount - 2; i >= 0; --i)
+    {
+      currentObject = currentObject->parent;
+      while(currentObject && !currentObject->fullName.endsWith(parts.at(i)))
+        currentObject = currentObject->parent;
+      if(!currentObject)
+        return false;
+    }
+    if(parent)
+    {
+      currentObject = currentObject->parent;
+      while(currentObject && currentObject->object != parent)
+        currentObject = currentObject->parent;
+      if(!currentObject)
+        return false;
+    }
+    return true;
+  };
+
+  for(auto i = kind ? registeredObjectsByKindAndName.constFind(kind) : registeredObjectsByKindAndName.constBegin(); i != registeredObjectsByKindAndName.constEnd(); ++i)
+  {
+    for(const RegisteredObject* object : *i)
+      if(object->fullName.endsWith(lastPart) && matches(object))
+        return object->object;
+
+    if(kind)
+      break;
+  }
+  return nullptr;
+}
+
+int HeadlessApplication::getObjectChildCount(const SimRobot::Object& object)
+{
+  const RegisteredObject* registeredObject = registeredObjectsByObject.value(&object);
+  return registeredObject ? registeredObject->children.count() : 0;
+}
+
+SimRobot::Object* HeadlessApplication::getObjectChild(const SimRobot::Object& object, int index)
+{
+  const RegisteredObject* registeredObject = registeredObjectsByObject.value(&object);
+  return registeredObject && index >= 0 && index < registeredObject->children.count() ? registeredObject->children[index]->object : nullptr;
+}
+
+bool HeadlessApplication::addStatusLabel(const SimRobot::Module& module, SimRobot::StatusLabel* statusLabel)
+{
+  if(!statusLabel)
+    return false;
+  statusLabels.append({&module, statusLabel});
+  return true;
+}
+
+bool HeadlessApplication::loadModule(const QString& name)
+{
+  if(loadedModulesByName.contains(name))
+    return true; // already loaded
+
+#ifdef WINDOWS
+  const QString& moduleName = name;
+#elif defined MACOS
+  QString moduleName = QFileInfo(appPath).dir().path() + "/../Resources/" + name;
+#else
+  QString moduleName = QFileInfo(appPath).path() + "/lib" + name + ".so";
+#endif
+  LoadedModule* loadedModule = new LoadedModule(moduleName);
+  loadedModule->createModule = reinterpret_cast<LoadedModule::CreateModuleProc>(loadedModule->resolve("createModule"));
+  if(!loadedModule->createModule)
+  {
+    showWarning("SimRobot", loadedModule->errorString());
+    loadedModule->unload();
+    delete loadedModule;
+    return false;
+  }
+  loadedModule->module = loadedModule->createModule(*this);
+  Q_ASSERT(loadedModule->module);
+  loadedModulesByName.insert(name, loadedModule);
+  loadedModules.append(loadedModule);
+  return true;
+}
+
+bool HeadlessApplication::selectObject(const SimRobot::Object& object)
+{
+  for(LoadedModule* loadedModule : loadedModules)
+    loadedModule->module->selectedObject(object);
+  return true;
+}
+
+void HeadlessApplication::showWarning(const QString& title, const QString& message)
+{
+  std::cerr << title.toUtf8().constData() << ": " << message.toUtf8().constData() << std::endl;
+}
+
+void HeadlessApplication::simStart()
+{
+  running = compileModules();
+}
@@ -0,0 +1,139 @@
+/**
+* @file SimRobotHeadless/HeadlessApplication.h
+* Declaration of an implementation of the SimRobot application interface that
+* runs a scene without any windows, e.g. for regression tests or parameter sweeps
+*/
+
+#pragma once
+
+#include <QHash>
+#include <QLibrary>
+#include <QList>
+#include <QSettings>
+#include <QTemporaryDir>
+#include <csignal>
+
+#include "SimRobot.h"
+
+class HeadlessApplication : public SimRobot::Application
+{
+public:
+  static volatile std::sig_atomic_t interrupted; /**< Set asynchronously (e.g. by a signal handler) to end the simulation. */
+
+  /**
+  * Constructor.
+  * @param appPath The path to the executable. The modules are searched next to it.
+  * @param options The command line options that the modules can query through getOption.
+  */
+  HeadlessApplication(const QString& appPath, const QHash<QString, QString>& options);
+
+  /** Destructor. Closes the scene if one is still open. */
+  ~HeadlessApplication();
+
+  /**
+  * Opens a scene, i.e. loads, compiles, and links all modules it requires.
+  * @param fileName The path to the scene file.
+  * @return Was the scene opened successfully?
+  */
+  bool openFile(const QString& fileName);
+
+  /** Closes the scene and unloads all modules. The modules finish their work in their destructors. */
+  void closeFile();
+
+  /**
+  * Runs the simulation as fast as possible.
+  * @param steps The number of simulation steps to execute. 0 runs until the simulation is stopped.
+  * @return The number of simulation steps executed.
+  */
+  unsigned run(unsigned steps);
+
+  /**
+  * Returns whether a module marked the run as failed, e.g. because a benchmark detected a regression.
+  * @return Did the run fail?
+  */
+  bool hasFailed() const {return failed;}
+
+private:
+  class LoadedModule : public QLibrary
+  {
+  public:
+    SimRobot::Module* module = nullptr;
+    bool compiled = false;
+    using CreateModuleProc = SimRobot::Module* (*)(SimRobot::Application&);
+    CreateModuleProc createModule = nullptr;
+
+    LoadedModule(const QString& name) : QLibrary(name) {}
+  };
+
+  /** The scene graph that the GUI would show, i.e. all objects that the modules registered. */
+  class RegisteredObject
+  {
+  public:
+    const SimRobot::Module* module;
+    SimRobot::Object* object;
+    RegisteredObject* parent;
+    const QString fullName;
+    const int kind; /**< Stored, because the object might already be deleted when it is unregistered. */
+    QList<RegisteredObject*> children;
+
+    RegisteredObject(const SimRobot::Module* module, SimRobot::Object* object, RegisteredObject* parent) :
+      module(module), object(object), parent(parent), fullName(object->getFullName()), kind(object->getKind()) {}
+  };
+
+  class RegisteredStatusLabel
+  {
+  public:
+    const SimRobot::Module* module;
+    SimRobot::StatusLabel* label;
+  };
+
+  QString appPath;
+  QHash<QString, QString> options; /**< The command line options. */
+  QTemporaryDir settingsDir; /**< A directory for the settings, because instances running in parallel must not share them. */
+  QSettings settings;
+  QSettings layoutSettings;
+  QString filePath; /**< The path to the currently opened file. */
+
+  bool opened = false;
+  bool compiled = false;
+  bool running = false;
+  bool resetRequested = false;
+  bool failed = false;
+
+  QList<LoadedModule*> loadedModules;
+  QHash<QString, LoadedModule*> loadedModulesByName;
+  QList<RegisteredObject*> rootObjects;
+  QHash<const SimRobot::Object*, RegisteredObject*> registeredObjectsByObject;
+  QHash<int, QHash<QString, RegisteredObject*>> registeredObjectsByKindAndName;
+  QList<RegisteredStatusLabel> statusLabels;
+
+  bool compileModules();
+  void deleteRegisteredObjectsFromModule(RegisteredObject* registeredObject, const SimRobot::Module* module);
+  void deleteRegisteredObject(RegisteredObject* registeredObject);
+
+  bool registerObject(const SimRobot::Module& module, SimRobot::Object& object, const SimRobot::Object* parent, int flags) override;
+  bool unregisterObject(const SimRobot::Object& object) override;
+  SimRobot::Object* resolveObject(const QString& fullName, int kind) override;
+  SimRobot::Object* resolveObject(const QVector<QString>& parts, const SimRobot::Object* parent, int kind) override;
+  int getObjectChildCount(const SimRobot::Object& object) override;
+  SimRobot::Object* getObjectChild(const SimRobot::Object& object, int index) override;
+  bool addStatusLabel(const SimRobot::Module& module, SimRobot::StatusLabel* statusLabel) override;
+  bool registerModule(const SimRobot::Module& module, const QString& displayName, const QString& name, int flags) override {return true;}
+  bool loadModule(const QString& name) override;
+  bool openObject(const SimRobot::Object& object) override {return false;}
+  bool closeObject(const SimRobot::Object& object) override {return false;}
+  bool selectObject(const SimRobot::Object& object) override;
+  void showWarning(const QString& title, const QString& message) override;
+  void setStatusMessage(const QString& message) override {}
+  const QString& getFilePath() const override {return filePath;}
+  const QString& getAppPath() const override {return appPath;}
+  QSettings& getSettings() override {return settings;}
+  QSettings& getLayoutSettings() override {return layoutSettings;}
+  QString getOption(const QString& name) const override {return options.value(name);}
+  void setFailed() override {failed = true;}
+  bool isSimRunning() override {return running;}
+  void simReset() override {resetRequested = true;}
+  void simStart() override;
+  void simStep() override {}
+  void simStop() override {running = false;}
+};
@@ -0,0 +1,90 @@
+/**
+* @file SimRobotHeadless/Main.cpp
+* Implementation of the main function of the headless SimRobot, i.e. a
+* command line application that runs a scene as fast as possible without
+* showing any windows. Several instances can run in parallel.
+*/
+
+#include <QApplication>
+#include <QFileInfo>
+#include <QHash>
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "HeadlessApplication.h"
+
+static void printUsage(const char* name)
+{
+  std::cerr << "Usage: " << name << " [options] <scene>.ros2" << std::endl
+            << "  -steps <n>       Stop after n simulation steps (default: until interrupted)." << std::endl
+            << "  -script <file>   Console script executed after the script of the scene." << std::endl
+            << "  -summary <file>  Write a JSON summary of the game events to this file." << std::endl
+            << "  -logs <dir>      Save the logs recorded by the robots to this directory." << std::endl
+            << "  -instance <n>    Number of this instance when several run in parallel (default: 0)." << std::endl;
+}
+
+static void interrupt(int)
+{
+  HeadlessApplication::interrupted = 1;
+}
+
+int main(int argc, char* argv[])
+{
+  // Camera images are rendered offscreen. A different platform (e.g. "xcb" with a virtual
+  // framebuffer) can still be selected through the environment.
+  if(qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+
+  QApplication app(argc, argv);
+  app.setApplicationName("SimRobotHeadless");
+
+  QHash<QString, QString> options;
+  options.insert("headless", "true");
+  unsigned steps = 0;
+  QString sceneFile;
+  for(int i = 1; i < argc; ++i)
+  {
+    if(!strcmp(argv[i], "-steps") && i + 1 < argc)
+      steps = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+    else if(!strcmp(argv[i], "-instance") && i + 1 < argc)
+      options.insert("instance", argv[++i]);
+    else if((!strcmp(argv[i], "-script") || !strcmp(argv[i], "-summary") || !strcmp(argv[i], "-logs")) && i + 1 < argc)
+    {
+      // Paths are passed as absolute paths, because the modules change the working directory.
+      options.insert(argv[i] + 1, QFileInfo(QString::fromLocal8Bit(argv[i + 1])).absoluteFilePath());
+      ++i;
+    }
+    else if(*argv[i] != '-' && sceneFile.isEmpty())
+      sceneFile = QString::fromLocal8Bit(argv[i]);
+    else
+    {
+      printUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if(sceneFile.isEmpty())
+  {
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  std::signal(SIGINT, interrupt);
+  std::signal(SIGTERM, interrupt);
+
+  HeadlessApplication application(QCoreApplication::applicationFilePath(), options);
+  if(!application.openFile(sceneFile))
+    return EXIT_FAILURE;
+
+  const auto start = std::chrono::steady_clock::now();
+  const unsigned executed = application.run(steps);
+  const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+  application.closeFile();
+
+  std::cerr << executed << " steps in " << duration.count() << " s (" << executed / std::max(duration.count(), 0.001) << " steps/s)" << std::endl;
+  return application.hasFailed() ? EXIT_FAILURE : EXIT_SUCCESS;
+}